@@ -0,0 +1,376 @@
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "autoTuner.h"
+
+// The parameter values searched, every round robin quantum, and every CFS pair with granularity <= target latency
+static const int32_t ROUND_ROBIN_QUANTA[] = {1, 2, 3, 4, 5, 6, 8, 10, 12, 16, 20, 24, 32, 48, 64};
+static const uint32_t TARGET_LATENCIES[] = {4, 8, 12, 16, 24, 32, 48, 64};
+static const uint32_t MINIMUM_GRANULARITIES[] = {1, 2, 3, 4, 6, 8};
+
+#define TOTAL_ROUND_ROBIN_QUANTA (sizeof(ROUND_ROBIN_QUANTA) / sizeof(ROUND_ROBIN_QUANTA[0]))
+#define TOTAL_TARGET_LATENCIES (sizeof(TARGET_LATENCIES) / sizeof(TARGET_LATENCIES[0]))
+#define TOTAL_MINIMUM_GRANULARITIES (sizeof(MINIMUM_GRANULARITIES) / sizeof(MINIMUM_GRANULARITIES[0]))
+
+/* The work shared between every worker thread of a search */
+struct TuningJob {
+    const struct ProcessSpecification* workload;
+    uint32_t totalProcesses;
+    const struct RandomNumberSource* randomSource;
+    struct TuningResult* result;
+
+    pthread_mutex_t lock;               // Guards everything below, and the results of every configuration
+    uint32_t nextConfiguration;         // The next configuration to be picked up by a worker
+    bool hasBestObjectiveValue;
+    double bestObjectiveValue;          // The best objective value of the finished runs so far (lower is better)
+};
+
+/* The state of a single worker thread */
+struct TuningWorker {
+    pthread_t thread;
+    struct TuningJob* job;
+    bool hasFailed;                     // Set if the worker ran out of memory, or a run failed
+    uint64_t* turnaroundTimes;          // Scratch space, one entry per process
+};
+
+/**
+ * Orders turnaround times from lowest to highest, for qsort()
+ */
+static int compareTurnaroundTimes(const void* first, const void* second)
+{
+    uint64_t firstTime = *(const uint64_t*) first;
+    uint64_t secondTime = *(const uint64_t*) second;
+    return (firstTime > secondTime) - (firstTime < secondTime);
+} // End of the compare turnaround times function
+
+/**
+ * Finds the 99th percentile of a set of turnaround times (the smallest time at least 99% of them are at most)
+ * NOTE: Sorts the turnaround times in place
+ */
+static uint64_t getTailLatency(uint64_t turnaroundTimes[], uint32_t totalProcesses)
+{
+    if (totalProcesses == 0)
+        return 0;
+    qsort(turnaroundTimes, totalProcesses, sizeof(uint64_t), compareTurnaroundTimes);
+    uint64_t rank = ((uint64_t) totalProcesses * 99 + 99) / 100;
+    return turnaroundTimes[rank - 1];
+} // End of the get tail latency function
+
+/**
+ * Retrieves the objective value of a finished run, oriented so that lower is always better
+ */
+static double getObjectiveValue(uint8_t objective, const struct TuningConfiguration* configuration)
+{
+    switch (objective)
+    {
+        case 0:
+            return configuration->averageWaitingTime;
+        case 1:
+            return configuration->averageTurnaroundTime;
+        case 2:
+            return -configuration->throughput;
+        default:
+            return (double) configuration->tailLatency;
+    }
+} // End of the get objective value function
+
+/**
+ * Checks whether an unfinished run can no longer be the best, nor on the Pareto front. Every process's turnaround
+ * time is at least its age so far, and the run finishes no earlier than the current cycle, which bounds each result.
+ */
+static bool isProvablyBeaten(struct TuningJob* job, const struct SchedulerContext* context, uint64_t turnaroundTimes[])
+{
+    uint64_t currentCycle = context->currentCycle;
+    double totalWaitingTime = 0.0;
+    double totalTurnaroundTime = 0.0;
+    uint32_t i = 0;
+    for (; i < context->totalCreatedProcesses; ++i)
+    {
+        const struct Process* process = &context->processContainer[i];
+        if (process->status == 4)
+            turnaroundTimes[i] = process->finishingTime - process->A;
+        else
+            turnaroundTimes[i] = (currentCycle > process->A) ? currentCycle - process->A : 0;
+        totalWaitingTime += process->currentWaitingTime;
+        totalTurnaroundTime += turnaroundTimes[i];
+    }
+
+    double maximumThroughput = 100 * ((double) context->totalCreatedProcesses / (double) currentCycle);
+    uint64_t minimumTailLatency = getTailLatency(turnaroundTimes, context->totalCreatedProcesses);
+    double minimumObjectiveValue;
+    switch (job->result->objective)
+    {
+        case 0:
+            minimumObjectiveValue = totalWaitingTime / context->totalCreatedProcesses;
+            break;
+        case 1:
+            minimumObjectiveValue = totalTurnaroundTime / context->totalCreatedProcesses;
+            break;
+        case 2:
+            minimumObjectiveValue = -maximumThroughput;
+            break;
+        default:
+            minimumObjectiveValue = (double) minimumTailLatency;
+            break;
+    }
+
+    bool isBeaten = false;
+    pthread_mutex_lock(&job->lock);
+    if (job->hasBestObjectiveValue && (minimumObjectiveValue > job->bestObjectiveValue))
+    {
+        // Worse on the objective, so also needs a finished run beating it on both throughput and tail latency
+        for (i = 0; (i < job->result->totalConfigurations) && !isBeaten; ++i)
+        {
+            const struct TuningConfiguration* configuration = &job->result->configurations[i];
+            isBeaten = configuration->isComplete && (configuration->throughput >= maximumThroughput)
+                       && (configuration->tailLatency < minimumTailLatency);
+        }
+    }
+    pthread_mutex_unlock(&job->lock);
+    return isBeaten;
+} // End of the is provably beaten function
+
+/**
+ * Runs configurations until there are none left
+ */
+static void* runTuningWorker(void* argument)
+{
+    struct TuningWorker* worker = argument;
+    struct TuningJob* job = worker->job;
+
+    // Checks whether to terminate a run early every so often, rarely enough that the checks take little time
+    uint32_t checkInterval = (job->totalProcesses > 64) ? job->totalProcesses : 64;
+
+    while (true)
+    {
+        pthread_mutex_lock(&job->lock);
+        uint32_t configurationIndex = job->nextConfiguration++;
+        pthread_mutex_unlock(&job->lock);
+        if (configurationIndex >= job->result->totalConfigurations)
+            break;
+
+        struct TuningConfiguration* configuration = &job->result->configurations[configurationIndex];
+        struct SchedulerContext* context = createSchedulerContext(job->workload, job->totalProcesses,
+                                                                  job->randomSource, configuration->schedulerAlgorithm);
+        if (context == NULL)
+        {
+            worker->hasFailed = true;
+            return NULL;
+        }
+        context->parameters = configuration->parameters;
+
+        bool isTerminatedEarly = false;
+        uint32_t cyclesUntilCheck = checkInterval;
+        while ((context->totalFinishedProcesses != context->totalCreatedProcesses) && (context->failure == 0))
+        {
+            skipIdleCycles(context);
+            stepScheduler(context);
+            if (--cyclesUntilCheck == 0)
+            {
+                cyclesUntilCheck = checkInterval;
+                if (isProvablyBeaten(job, context, worker->turnaroundTimes))
+                {
+                    isTerminatedEarly = true;
+                    break;
+                }
+            }
+        }
+        if (context->failure != 0)
+        {
+            worker->hasFailed = true;
+            destroySchedulerContext(context);
+            return NULL;
+        }
+
+        struct SummaryMetrics summary;
+        if (!isTerminatedEarly)
+        {
+            getSummaryMetrics(context, &summary);
+            uint32_t i = 0;
+            for (; i < context->totalCreatedProcesses; ++i)
+                worker->turnaroundTimes[i] = context->processContainer[i].finishingTime - context->processContainer[i].A;
+        }
+
+        pthread_mutex_lock(&job->lock);
+        if (isTerminatedEarly)
+            ++job->result->totalTerminatedEarly;
+        else
+        {
+            configuration->averageWaitingTime = summary.averageWaitingTime;
+            configuration->averageTurnaroundTime = summary.averageTurnaroundTime;
+            configuration->throughput = summary.throughput;
+            configuration->tailLatency = getTailLatency(worker->turnaroundTimes, context->totalCreatedProcesses);
+            configuration->isComplete = true;
+
+            double objectiveValue = getObjectiveValue(job->result->objective, configuration);
+            if (!job->hasBestObjectiveValue || (objectiveValue < job->bestObjectiveValue))
+            {
+                job->hasBestObjectiveValue = true;
+                job->bestObjectiveValue = objectiveValue;
+            }
+        }
+        pthread_mutex_unlock(&job->lock);
+        destroySchedulerContext(context);
+    }
+    return NULL;
+} // End of the run tuning worker function
+
+/**
+ * Lists every configuration to try, with EDF only for workloads with deadlines
+ * @return false if out of memory
+ */
+static bool createConfigurations(const struct ProcessSpecification workload[], uint32_t totalProcesses,
+                                 struct TuningResult* result)
+{
+    bool hasDeadlines = false;
+    uint32_t i = 0;
+    for (; i < totalProcesses; ++i)
+    {
+        if (workload[i].D != 0)
+            hasDeadlines = true;
+    }
+
+    uint32_t maximumConfigurations = 5 + TOTAL_ROUND_ROBIN_QUANTA + TOTAL_TARGET_LATENCIES * TOTAL_MINIMUM_GRANULARITIES;
+    result->configurations = calloc(maximumConfigurations, sizeof(struct TuningConfiguration));
+    if (result->configurations == NULL)
+        return false;
+
+    struct SchedulerParameters defaultParameters = {DEFAULT_ROUND_ROBIN_QUANTUM, DEFAULT_TARGET_LATENCY,
+                                                    DEFAULT_MINIMUM_GRANULARITY};
+    uint32_t totalConfigurations = 0;
+    uint8_t schedulerAlgorithm = 0;
+    for (; schedulerAlgorithm <= 5; ++schedulerAlgorithm)
+    {
+        if ((schedulerAlgorithm == 1) || (schedulerAlgorithm == 5) || ((schedulerAlgorithm == 4) && !hasDeadlines))
+            continue;
+        result->configurations[totalConfigurations].schedulerAlgorithm = schedulerAlgorithm;
+        result->configurations[totalConfigurations++].parameters = defaultParameters;
+    }
+
+    for (i = 0; i < TOTAL_ROUND_ROBIN_QUANTA; ++i)
+    {
+        result->configurations[totalConfigurations].schedulerAlgorithm = 1;
+        result->configurations[totalConfigurations].parameters = defaultParameters;
+        result->configurations[totalConfigurations++].parameters.roundRobinQuantum = ROUND_ROBIN_QUANTA[i];
+    }
+
+    for (i = 0; i < TOTAL_TARGET_LATENCIES; ++i)
+    {
+        uint32_t j = 0;
+        for (; (j < TOTAL_MINIMUM_GRANULARITIES) && (MINIMUM_GRANULARITIES[j] <= TARGET_LATENCIES[i]); ++j)
+        {
+            result->configurations[totalConfigurations].schedulerAlgorithm = 5;
+            result->configurations[totalConfigurations].parameters = defaultParameters;
+            result->configurations[totalConfigurations].parameters.targetLatency = TARGET_LATENCIES[i];
+            result->configurations[totalConfigurations++].parameters.minimumGranularity = MINIMUM_GRANULARITIES[j];
+        }
+    }
+
+    result->totalConfigurations = totalConfigurations;
+    return true;
+} // End of the create configurations function
+
+/**
+ * Tries every configuration on a workload, spread over worker threads
+ */
+bool tuneScheduler(const struct ProcessSpecification workload[], uint32_t totalProcesses,
+                   const struct RandomNumberSource* randomSource, uint8_t objective, uint32_t totalThreads,
+                   struct TuningResult* result)
+{
+    result->objective = objective;
+    result->bestConfiguration = 0;
+    result->totalTerminatedEarly = 0;
+    if (!createConfigurations(workload, totalProcesses, result))
+        return false;
+
+    if (totalThreads == 0)
+        totalThreads = 1;
+    if (totalThreads > result->totalConfigurations)
+        totalThreads = result->totalConfigurations;
+
+    struct TuningJob job = {.workload = workload, .totalProcesses = totalProcesses, .randomSource = randomSource,
+                            .result = result};
+    job.nextConfiguration = 0;
+    job.hasBestObjectiveValue = false;
+    struct TuningWorker* workers = calloc(totalThreads, sizeof(struct TuningWorker));
+    if (workers == NULL)
+    {
+        freeTuningResult(result);
+        return false;
+    }
+    pthread_mutex_init(&job.lock, NULL);
+
+    // Starts every worker, then waits for them all to finish
+    bool isSuccessful = true;
+    uint32_t totalStartedThreads = 0;
+    for (; totalStartedThreads < totalThreads; ++totalStartedThreads)
+    {
+        struct TuningWorker* worker = &workers[totalStartedThreads];
+        worker->job = &job;
+        worker->turnaroundTimes = calloc(totalProcesses + 1, sizeof(uint64_t));
+        if ((worker->turnaroundTimes == NULL)
+            || (pthread_create(&worker->thread, NULL, runTuningWorker, worker) != 0))
+        {
+            free(worker->turnaroundTimes);
+            isSuccessful = false;
+            break;
+        }
+    }
+
+    uint32_t i = 0;
+    for (; i < totalStartedThreads; ++i)
+    {
+        pthread_join(workers[i].thread, NULL);
+        if (workers[i].hasFailed)
+            isSuccessful = false;
+        free(workers[i].turnaroundTimes);
+    }
+    pthread_mutex_destroy(&job.lock);
+    free(workers);
+
+    if (!isSuccessful)
+    {
+        freeTuningResult(result);
+        return false;
+    }
+
+    // Picks the best finished run, the first configuration winning any tie, so that the threads make no difference
+    bool hasBestConfiguration = false;
+    for (i = 0; i < result->totalConfigurations; ++i)
+    {
+        const struct TuningConfiguration* configuration = &result->configurations[i];
+        if (configuration->isComplete && (!hasBestConfiguration || (getObjectiveValue(objective, configuration)
+                < getObjectiveValue(objective, &result->configurations[result->bestConfiguration]))))
+        {
+            hasBestConfiguration = true;
+            result->bestConfiguration = i;
+        }
+    }
+
+    // Marks every finished run that no other finished run beats on both throughput and tail latency
+    for (i = 0; i < result->totalConfigurations; ++i)
+    {
+        struct TuningConfiguration* configuration = &result->configurations[i];
+        configuration->isParetoOptimal = configuration->isComplete;
+        uint32_t j = 0;
+        for (; (j < result->totalConfigurations) && configuration->isParetoOptimal; ++j)
+        {
+            const struct TuningConfiguration* other = &result->configurations[j];
+            if (other->isComplete && (other->throughput >= configuration->throughput)
+                && (other->tailLatency <= configuration->tailLatency)
+                && ((other->throughput > configuration->throughput) || (other->tailLatency < configuration->tailLatency)))
+                configuration->isParetoOptimal = false;
+        }
+    }
+    return true;
+} // End of the tune scheduler function
+
+/**
+ * Releases the configurations held by a tuning result
+ */
+void freeTuningResult(struct TuningResult* result)
+{
+    free(result->configurations);
+    result->configurations = NULL;
+    result->totalConfigurations = 0;
+} // End of the free tuning result function
@@ -0,0 +1,57 @@
+#ifndef AUTO_TUNER_H
+#define AUTO_TUNER_H
+
+#include <stdint.h>
+
+#include "libscheduler.h"
+
+/*
+ * Searches the scheduler algorithms and their parameters (the round robin quantum, and the CFS target latency and
+ * minimum granularity) for the best configuration for a workload, running the configurations in parallel. A run is
+ * terminated early once it can be proven both worse on the objective than the best finished run so far, and beaten on
+ * throughput and tail latency by a single finished run, so that it cannot be the best nor on the Pareto front.
+ */
+
+/* A single configuration tried, and its results */
+struct TuningConfiguration {
+    uint8_t schedulerAlgorithm;         // 0 = FCFS, 1 = RR, 2 = UNI, 3 = SJF, 4 = EDF, 5 = CFS
+    struct SchedulerParameters parameters;
+
+    bool isComplete;                    // false if the run was terminated early (and the results below are unset)
+    bool isParetoOptimal;               // Whether no other configuration has both a higher throughput and lower tail
+    double averageWaitingTime;
+    double averageTurnaroundTime;
+    double throughput;                  // Processes finished per hundred cycles
+    uint64_t tailLatency;               // The 99th percentile turnaround time
+};
+
+/* The results of a whole search */
+struct TuningResult {
+    uint8_t objective;                  // 0 = average waiting time, 1 = average turnaround time, 2 = throughput, 3 = tail
+    struct TuningConfiguration* configurations;
+    uint32_t totalConfigurations;
+    uint32_t bestConfiguration;         // The index in configurations of the best on the objective
+    uint32_t totalTerminatedEarly;      // Depends on which runs happened to finish first, so varies between searches
+};
+
+/**
+ * Tries every configuration on a workload, spread over worker threads
+ * @param workload The processes to simulate, in input order
+ * @param totalProcesses The number of processes in workload
+ * @param randomSource The random numbers to use, the same for every configuration
+ * @param objective What to optimise. 0 = minimise the average waiting time, 1 = minimise the average turnaround time,
+ * 2 = maximise the throughput, 3 = minimise the tail latency (the 99th percentile turnaround time).
+ * @param totalThreads The number of worker threads (at least 1)
+ * @param result Filled in with every configuration tried, to be released with freeTuningResult()
+ * @return false if out of memory or the threads could not be started
+ */
+bool tuneScheduler(const struct ProcessSpecification workload[], uint32_t totalProcesses,
+                   const struct RandomNumberSource* randomSource, uint8_t objective, uint32_t totalThreads,
+                   struct TuningResult* result);
+
+/**
+ * Releases the configurations held by a tuning result
+ */
+void freeTuningResult(struct TuningResult* result);
+
+#endif // AUTO_TUNER_H
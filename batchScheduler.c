@@ -0,0 +1,736 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "batchScheduler.h"
+
+/* A lane's rough length in cycles, used to pack lanes of a similar length into the same block */
+struct LaneEstimate {
+    double length;
+    uint32_t lane;
+};
+
+/************************ START OF LANE HELPER FUNCTIONS *************************************/
+
+/**
+ * Retrieves the absolute deadline of a process, with processes without a deadline coming after every other
+ */
+static uint64_t getBatchAbsoluteDeadline(const struct SchedulerBatch* batch, size_t entry)
+{
+    return (batch->D[entry] == 0) ? UINT64_MAX : batch->A[entry] + batch->D[entry];
+} // End of the get batch absolute deadline function
+
+/**
+ * Removes the entry at a position from a lane's ready queue or blocked list, keeping the rest in order
+ */
+static uint32_t removeFromLaneQueue(uint32_t queue[], uint32_t* queueSize, uint32_t position)
+{
+    uint32_t processID = queue[position];
+    memmove(&queue[position], &queue[position + 1], (*queueSize - position - 1) * sizeof(uint32_t));
+    --*queueSize;
+    return processID;
+} // End of the remove from lane queue function
+
+/**
+ * Retrieves the "random" number for the next CPU burst of a process of a lane
+ */
+static uint32_t nextBatchRandomNumber(struct SchedulerBatch* batch, struct BatchLane* lane, uint32_t processID,
+                                      size_t entry)
+{
+    uint64_t burstIndex = batch->totalCPUBursts[entry]++;
+    if (batch->randomSource->isCounterBased)
+        return counterBasedRandomNumber(batch->randomSource->seed, processID, burstIndex);
+
+    if (lane->randomNumberIndex >= batch->randomSource->totalRandomNumbers)
+    {
+        // Ran off the end of the random number file, the run stops at the end of this cycle
+        batch->hasFailed = true;
+        return 0;
+    }
+    // Starting from the lane's offset, wraps around to the start of the file as nextRandomNumber() does
+    uint32_t fileIndex = (uint32_t) (((uint64_t) lane->randomNumberOffset + lane->randomNumberIndex++)
+                                     % batch->randomSource->totalRandomNumbers);
+    return batch->randomSource->randomNumbers[fileIndex];
+} // End of the next batch random number function
+
+/**
+ * Estimates how many cycles a workload will take: at least as long as its longest process takes alone (assuming its
+ * I/O takes M times its CPU time), and as long as it takes to run every process one after the other
+ */
+static double estimateLaneLength(const struct ProcessSpecification workload[], uint32_t totalProcesses)
+{
+    double longestProcess = 0.0;
+    double earliestArrival = (totalProcesses == 0) ? 0.0 : (double) workload[0].A;
+    double totalCPUTime = 0.0;
+    uint32_t i = 0;
+    for (; i < totalProcesses; ++i)
+    {
+        double processLength = (double) workload[i].A + (double) workload[i].C * (1.0 + (double) workload[i].M);
+        if (processLength > longestProcess)
+            longestProcess = processLength;
+        if ((double) workload[i].A < earliestArrival)
+            earliestArrival = (double) workload[i].A;
+        totalCPUTime += (double) workload[i].C;
+    }
+    return (earliestArrival + totalCPUTime > longestProcess) ? earliestArrival + totalCPUTime : longestProcess;
+} // End of the estimate lane length function
+
+/**
+ * Orders lanes by estimated length, then by lane, for qsort()
+ */
+static int compareLaneEstimates(const void* first, const void* second)
+{
+    const struct LaneEstimate* firstEstimate = first;
+    const struct LaneEstimate* secondEstimate = second;
+    if (firstEstimate->length != secondEstimate->length)
+        return (firstEstimate->length < secondEstimate->length) ? -1 : 1;
+    return (firstEstimate->lane < secondEstimate->lane) ? -1 : 1;
+} // End of the compare lane estimates function
+
+/************************ END OF LANE HELPER FUNCTIONS *************************************/
+
+/************************ START OF RUNNING PROGRAM FUNCTIONS *************************************/
+
+/**
+ * Checks off each deadline of a lane that has passed, until the first one missed (a process still unfinished after it)
+ */
+static void findFirstBatchDeadlineMiss(struct SchedulerBatch* batch, struct BatchLane* lane, uint32_t slot)
+{
+    while (lane->nextDeadlineIndex < lane->totalDeadlineProcesses)
+    {
+        size_t entry = (size_t) lane->deadlineOrder[lane->nextDeadlineIndex] * batch->laneStride + slot;
+        if (getBatchAbsoluteDeadline(batch, entry) >= lane->currentCycle)
+            break;
+        if (batch->status[entry] != 4)
+        {
+            // Still unfinished, so it will finish after its deadline
+            lane->firstMissCycle = (int64_t) lane->currentCycle;
+            uint32_t i = 0;
+            for (; i < lane->totalProcesses; ++i)
+                lane->CPUTimeBeforeFirstMiss += batch->currentCPUTimeRun[(size_t) i * batch->laneStride + slot];
+            break;
+        }
+        ++lane->nextDeadlineIndex;
+    }
+} // End of the find first batch deadline miss function
+
+/**
+ * Processes the running process of a lane, which terminates, blocks, is preempted or keeps running
+ */
+static void doBatchRunningProcess(struct SchedulerBatch* batch, struct BatchLane* lane, uint32_t slot)
+{
+    if (lane->runningProcess == BATCH_NO_PROCESS)
+        return;
+
+    size_t entry = (size_t) lane->runningProcess * batch->laneStride + slot;
+    if (batch->isFirstTimeRunning[entry])
+    {
+        batch->isFirstTimeRunning[entry] = false;
+        batch->IOBurst[entry] = (int64_t) (1 + (batch->M[entry] * batch->CPUBurst[entry]));
+    }
+
+    if (batch->C[entry] == batch->currentCPUTimeRun[entry])
+    {
+        // Process has completed running
+        batch->status[entry] = 4;
+        batch->finishingTime[entry] = lane->currentCycle;
+        ++lane->totalFinishedProcesses;
+        lane->runningProcess = BATCH_NO_PROCESS;
+    }
+    else if (batch->CPUBurst[entry] == 0)
+    {
+        // Process has run out of CPU burst, moves to blocked
+        batch->status[entry] = 3;
+        lane->blockedList[lane->blockedListSize++] = lane->runningProcess;
+        lane->runningProcess = BATCH_NO_PROCESS;
+    }
+    else if ((batch->schedulerAlgorithm == 1) && (batch->quantum[entry] <= 0))
+    {
+        // Process has been preempted, moves to ready
+        batch->status[entry] = 1;
+        lane->readyQueue[lane->readyQueueSize++] = lane->runningProcess;
+        lane->runningProcess = BATCH_NO_PROCESS;
+    }
+} // End of the do batch running process function
+
+/**
+ * Unblocks the first process of a lane's blocked list whose I/O has finished, as doBlockedProcesses() does
+ */
+static void doBatchBlockedProcesses(struct SchedulerBatch* batch, struct BatchLane* lane, uint32_t slot)
+{
+    uint32_t i = 0;
+    for (; i < lane->blockedListSize; ++i)
+    {
+        size_t entry = (size_t) lane->blockedList[i] * batch->laneStride + slot;
+        if (batch->IOBurst[entry] <= 0)
+        {
+            // Only one process moves to ready per cycle, as the rest of the list is not checked after it
+            batch->status[entry] = 1;
+            lane->readyQueue[lane->readyQueueSize++] = removeFromLaneQueue(lane->blockedList, &lane->blockedListSize, i);
+            return;
+        }
+    }
+} // End of the do batch blocked processes function
+
+/**
+ * Starts any process of a lane that begins this cycle, in process order
+ */
+static void createBatchProcesses(struct SchedulerBatch* batch, struct BatchLane* lane, uint32_t slot)
+{
+    while (lane->nextArrivalIndex < lane->totalProcesses)
+    {
+        uint32_t processID = lane->arrivalOrder[lane->nextArrivalIndex];
+        size_t entry = (size_t) processID * batch->laneStride + slot;
+        if (batch->A[entry] != lane->currentCycle)
+            break;
+        batch->status[entry] = 1;
+        lane->readyQueue[lane->readyQueueSize++] = processID;
+        ++lane->nextArrivalIndex;
+    }
+} // End of the create batch processes function
+
+/**
+ * Picks the ready process of a lane to run next, preempting the running process under EDF if need be
+ */
+static void doBatchReadyProcesses(struct SchedulerBatch* batch, struct BatchLane* lane, uint32_t slot)
+{
+    if ((lane->readyQueueSize == 0)
+        || ((lane->runningProcess != BATCH_NO_PROCESS) && (batch->schedulerAlgorithm != 4)))
+        return;
+
+    // Finds the ready process that would run next: the front, or the shortest job, or the earliest deadline
+    uint32_t position = 0;
+    uint32_t i = 1;
+    for (; (i < lane->readyQueueSize) && (batch->schedulerAlgorithm >= 3); ++i)
+    {
+        size_t entry = (size_t) lane->readyQueue[i] * batch->laneStride + slot;
+        size_t bestEntry = (size_t) lane->readyQueue[position] * batch->laneStride + slot;
+        if (batch->schedulerAlgorithm == 3)
+        {
+            // The first process with the lowest remaining CPU time
+            if ((batch->C[bestEntry] - batch->currentCPUTimeRun[bestEntry])
+                > (batch->C[entry] - batch->currentCPUTimeRun[entry]))
+                position = i;
+        }
+        else if (getBatchAbsoluteDeadline(batch, entry) < getBatchAbsoluteDeadline(batch, bestEntry))
+        {
+            // The earliest deadline, with ties going to whichever became ready first (the earlier in the queue)
+            position = i;
+        }
+    }
+
+    size_t readiedEntry = (size_t) lane->readyQueue[position] * batch->laneStride + slot;
+    if (lane->runningProcess != BATCH_NO_PROCESS)
+    {
+        // [EDF] Preempts the running process if a process with an earlier deadline has become ready
+        size_t runningEntry = (size_t) lane->runningProcess * batch->laneStride + slot;
+        if (getBatchAbsoluteDeadline(batch, readiedEntry) >= getBatchAbsoluteDeadline(batch, runningEntry))
+            return;
+        batch->status[runningEntry] = 1;
+        lane->readyQueue[lane->readyQueueSize++] = lane->runningProcess;
+        lane->runningProcess = BATCH_NO_PROCESS;
+    }
+
+    uint32_t readiedProcess = removeFromLaneQueue(lane->readyQueue, &lane->readyQueueSize, position);
+    uint32_t unsignedRandomInteger = nextBatchRandomNumber(batch, lane, readiedProcess, readiedEntry);
+    uint64_t newCPUBurst = 1 + (unsignedRandomInteger % batch->B[readiedEntry]);
+    uint64_t remainingCPUTime = batch->C[readiedEntry] - batch->currentCPUTimeRun[readiedEntry];
+    batch->CPUBurst[readiedEntry] = (newCPUBurst > remainingCPUTime) ? remainingCPUTime : newCPUBurst;
+
+    // SJF always runs the process it picked, the others only with a positive CPU burst (as in doReadyProcesses())
+    if ((batch->schedulerAlgorithm == 3) || (batch->CPUBurst[readiedEntry] > 0))
+    {
+        batch->status[readiedEntry] = 2;
+        batch->isFirstTimeRunning[readiedEntry] = true;
+        if (batch->schedulerAlgorithm == 1)
+            batch->quantum[readiedEntry] = batch->parameters.roundRobinQuantum;
+        lane->runningProcess = readiedProcess;
+    }
+} // End of the do batch ready processes function
+
+/**
+ * Alters the timers of a single process across a whole block of lanes, without branching. Each array starts at the
+ * process's entry for the first slot of the block, and none of them overlap, which lets the compiler vectorise the loop.
+ */
+static void incrementBlockTimers(const uint8_t* restrict status, uint64_t* restrict CPUBurst, int64_t* restrict IOBurst,
+                                 int64_t* restrict quantum, uint64_t* restrict currentCPUTimeRun,
+                                 uint64_t* restrict currentIOBlockedTime, uint64_t* restrict currentWaitingTime,
+                                 uint8_t* restrict isLaneBlocked, int64_t quantumStep)
+{
+    uint32_t slotOffset = 0;
+    for (; slotOffset < BATCH_BLOCK_LANES; ++slotOffset)
+    {
+        uint64_t isReady = (status[slotOffset] == 1);
+        uint64_t isRunning = (status[slotOffset] == 2);
+        uint64_t isBlocked = (status[slotOffset] == 3);
+
+        currentWaitingTime[slotOffset] += isReady;
+        currentCPUTimeRun[slotOffset] += isRunning;
+        CPUBurst[slotOffset] -= isRunning;
+        quantum[slotOffset] -= (int64_t) isRunning * quantumStep;
+        currentIOBlockedTime[slotOffset] += isBlocked;
+        IOBurst[slotOffset] -= (int64_t) isBlocked;
+        isLaneBlocked[slotOffset] |= (uint8_t) isBlocked;
+    }
+} // End of the increment block timers function
+
+/**
+ * Alters the timers of every process of a block, as incrementTimers() does for a context. Lanes that have finished (and
+ * padding processes) are never ready, running nor blocked, so are left unchanged without a branch.
+ */
+static void incrementBatchTimers(struct SchedulerBatch* batch, uint32_t firstSlot)
+{
+    // Only RR counts down the quantum (CFS is never run in lanes)
+    int64_t quantumStep = (batch->schedulerAlgorithm == 1) ? 1 : 0;
+    uint8_t* isLaneBlocked = &batch->isLaneBlocked[firstSlot];
+    memset(isLaneBlocked, 0, BATCH_BLOCK_LANES);
+
+    uint32_t i = 0;
+    for (; i < batch->maximumProcesses; ++i)
+    {
+        size_t firstEntry = (size_t) i * batch->laneStride + firstSlot;
+        incrementBlockTimers(&batch->status[firstEntry], &batch->CPUBurst[firstEntry], &batch->IOBurst[firstEntry],
+                             &batch->quantum[firstEntry], &batch->currentCPUTimeRun[firstEntry],
+                             &batch->currentIOBlockedTime[firstEntry], &batch->currentWaitingTime[firstEntry],
+                             isLaneBlocked, quantumStep);
+    }
+
+    uint32_t slotOffset = 0;
+    for (; slotOffset < BATCH_BLOCK_LANES; ++slotOffset)
+        batch->lanes[firstSlot + slotOffset].totalNumberOfCyclesSpentBlocked += isLaneBlocked[slotOffset];
+} // End of the increment batch timers function
+
+/************************ END OF RUNNING PROGRAM FUNCTIONS *************************************/
+
+/************************ START OF BATCH FUNCTIONS *************************************/
+
+/**
+ * Creates a batch of workloads, ready to be run from cycle 0
+ */
+struct SchedulerBatch* createSchedulerBatch(const struct ProcessSpecification* const workloads[],
+                                            const uint32_t totalProcesses[], uint32_t totalLanes,
+                                            const struct RandomNumberSource* randomSource, uint8_t schedulerAlgorithm)
+{
+    struct SchedulerBatch* batch = calloc(1, sizeof(struct SchedulerBatch));
+    if (batch == NULL)
+        return NULL;
+
+    batch->schedulerAlgorithm = schedulerAlgorithm;
+    batch->parameters.roundRobinQuantum = DEFAULT_ROUND_ROBIN_QUANTUM;
+    batch->parameters.targetLatency = DEFAULT_TARGET_LATENCY;
+    batch->parameters.minimumGranularity = DEFAULT_MINIMUM_GRANULARITY;
+    batch->randomSource = randomSource;
+    batch->totalLanes = totalLanes;
+    batch->laneStride = (totalLanes + BATCH_BLOCK_LANES - 1) / BATCH_BLOCK_LANES * BATCH_BLOCK_LANES;
+    uint32_t lane = 0;
+    for (; lane < totalLanes; ++lane)
+    {
+        if (totalProcesses[lane] > batch->maximumProcesses)
+            batch->maximumProcesses = totalProcesses[lane];
+    }
+
+    // Pads the slots out to whole blocks with empty lanes, and allocates one extra entry, so that an empty batch does
+    // not request zero bytes
+    size_t totalEntries = (size_t) batch->maximumProcesses * batch->laneStride + 1;
+    struct LaneEstimate* estimates = calloc(totalLanes + 1, sizeof(struct LaneEstimate));
+    batch->laneSlots = calloc(totalLanes + 1, sizeof(uint32_t));
+    batch->lanes = calloc(batch->laneStride + 1, sizeof(struct BatchLane));
+    batch->A = calloc(totalEntries, sizeof(uint64_t));
+    batch->B = calloc(totalEntries, sizeof(uint64_t));
+    batch->C = calloc(totalEntries, sizeof(uint64_t));
+    batch->M = calloc(totalEntries, sizeof(uint64_t));
+    batch->D = calloc(totalEntries, sizeof(uint64_t));
+    batch->niceness = calloc(totalEntries, sizeof(int32_t));
+    batch->status = calloc(totalEntries, sizeof(uint8_t));
+    batch->isFirstTimeRunning = calloc(totalEntries, sizeof(uint8_t));
+    batch->CPUBurst = calloc(totalEntries, sizeof(uint64_t));
+    batch->IOBurst = calloc(totalEntries, sizeof(int64_t));
+    batch->quantum = calloc(totalEntries, sizeof(int64_t));
+    batch->totalCPUBursts = calloc(totalEntries, sizeof(uint64_t));
+    batch->currentCPUTimeRun = calloc(totalEntries, sizeof(uint64_t));
+    batch->currentIOBlockedTime = calloc(totalEntries, sizeof(uint64_t));
+    batch->currentWaitingTime = calloc(totalEntries, sizeof(uint64_t));
+    batch->finishingTime = calloc(totalEntries, sizeof(uint64_t));
+    batch->laneQueues = calloc(4 * totalEntries, sizeof(uint32_t));
+    batch->isLaneBlocked = calloc(batch->laneStride + 1, sizeof(uint8_t));
+    if ((estimates == NULL) || (batch->laneSlots == NULL) || (batch->lanes == NULL) || (batch->A == NULL)
+        || (batch->B == NULL) || (batch->C == NULL) || (batch->M == NULL) || (batch->D == NULL)
+        || (batch->niceness == NULL) || (batch->status == NULL) || (batch->isFirstTimeRunning == NULL)
+        || (batch->CPUBurst == NULL) || (batch->IOBurst == NULL) || (batch->quantum == NULL)
+        || (batch->totalCPUBursts == NULL) || (batch->currentCPUTimeRun == NULL)
+        || (batch->currentIOBlockedTime == NULL) || (batch->currentWaitingTime == NULL)
+        || (batch->finishingTime == NULL) || (batch->laneQueues == NULL) || (batch->isLaneBlocked == NULL))
+    {
+        free(estimates);
+        destroySchedulerBatch(batch);
+        return NULL;
+    }
+
+    // Packs the lanes into slots shortest first, so that the lanes of each block tend to finish at around the same time
+    for (lane = 0; lane < totalLanes; ++lane)
+    {
+        estimates[lane].length = estimateLaneLength(workloads[lane], totalProcesses[lane]);
+        estimates[lane].lane = lane;
+    }
+    qsort(estimates, totalLanes, sizeof(struct LaneEstimate), compareLaneEstimates);
+
+    uint32_t slot = 0;
+    for (; slot < totalLanes; ++slot)
+    {
+        lane = estimates[slot].lane;
+        batch->laneSlots[lane] = slot;
+        struct BatchLane* batchLane = &batch->lanes[slot];
+        batchLane->totalProcesses = totalProcesses[lane];
+        batchLane->readyQueue = &batch->laneQueues[(size_t) (4 * slot) * batch->maximumProcesses];
+        batchLane->blockedList = &batch->laneQueues[(size_t) (4 * slot + 1) * batch->maximumProcesses];
+        batchLane->deadlineOrder = &batch->laneQueues[(size_t) (4 * slot + 2) * batch->maximumProcesses];
+        batchLane->arrivalOrder = &batch->laneQueues[(size_t) (4 * slot + 3) * batch->maximumProcesses];
+
+        uint32_t i = 0;
+        for (; i < batchLane->totalProcesses; ++i)
+        {
+            size_t entry = (size_t) i * batch->laneStride + slot;
+            const struct ProcessSpecification* specification = &workloads[lane][i];
+            batch->A[entry] = specification->A;
+            batch->B[entry] = specification->B;
+            batch->C[entry] = specification->C;
+            batch->M[entry] = specification->M;
+            batch->D[entry] = specification->D;
+            batch->niceness[entry] = specification->niceness;
+
+            // Inserts into the arrival order behind any earlier (or equal) arrival, so that processes arriving on the
+            // same cycle are created in process order
+            uint32_t position = i;
+            while ((position != 0)
+                   && (batch->A[(size_t) batchLane->arrivalOrder[position - 1] * batch->laneStride + slot] > specification->A))
+            {
+                batchLane->arrivalOrder[position] = batchLane->arrivalOrder[position - 1];
+                --position;
+            }
+            batchLane->arrivalOrder[position] = i;
+            if (specification->D == 0)
+                continue;
+
+            // Likewise inserts into the deadline order, as compareDeadlines() sorts
+            position = batchLane->totalDeadlineProcesses++;
+            while ((position != 0)
+                   && (getBatchAbsoluteDeadline(batch, (size_t) batchLane->deadlineOrder[position - 1] * batch->laneStride + slot)
+                       > getBatchAbsoluteDeadline(batch, entry)))
+            {
+                batchLane->deadlineOrder[position] = batchLane->deadlineOrder[position - 1];
+                --position;
+            }
+            batchLane->deadlineOrder[position] = i;
+        }
+    }
+    free(estimates);
+
+    resetSchedulerBatch(batch);
+    return batch;
+} // End of the create scheduler batch function
+
+/**
+ * Releases a batch created with createSchedulerBatch()
+ */
+void destroySchedulerBatch(struct SchedulerBatch* batch)
+{
+    if (batch == NULL)
+        return;
+    free(batch->laneSlots);
+    free(batch->lanes);
+    free(batch->A);
+    free(batch->B);
+    free(batch->C);
+    free(batch->M);
+    free(batch->D);
+    free(batch->niceness);
+    free(batch->status);
+    free(batch->isFirstTimeRunning);
+    free(batch->CPUBurst);
+    free(batch->IOBurst);
+    free(batch->quantum);
+    free(batch->totalCPUBursts);
+    free(batch->currentCPUTimeRun);
+    free(batch->currentIOBlockedTime);
+    free(batch->currentWaitingTime);
+    free(batch->finishingTime);
+    free(batch->laneQueues);
+    free(batch->isLaneBlocked);
+    free(batch);
+} // End of the destroy scheduler batch function
+
+/**
+ * Resets every lane so that the batch can be run again from cycle 0
+ */
+void resetSchedulerBatch(struct SchedulerBatch* batch)
+{
+    batch->hasFailed = false;
+    batch->totalRunningLanes = 0;
+    uint32_t slot = 0;
+    for (; slot < batch->totalLanes; ++slot)
+    {
+        struct BatchLane* lane = &batch->lanes[slot];
+        lane->isRunning = (lane->totalProcesses != 0);
+        if (lane->isRunning)
+            ++batch->totalRunningLanes;
+        lane->currentCycle = 0;
+        lane->runningProcess = BATCH_NO_PROCESS;
+        lane->readyQueueSize = 0;
+        lane->blockedListSize = 0;
+        lane->nextArrivalIndex = 0;
+        lane->totalFinishedProcesses = 0;
+        lane->randomNumberIndex = 0;
+        lane->totalNumberOfCyclesSpentBlocked = 0;
+        lane->nextDeadlineIndex = 0;
+        lane->firstMissCycle = -1;
+        lane->CPUTimeBeforeFirstMiss = 0;
+    }
+
+    size_t totalEntries = (size_t) batch->maximumProcesses * batch->laneStride;
+    memset(batch->status, 0, totalEntries * sizeof(uint8_t));
+    memset(batch->isFirstTimeRunning, 0, totalEntries * sizeof(uint8_t));
+    memset(batch->CPUBurst, 0, totalEntries * sizeof(uint64_t));
+    memset(batch->IOBurst, 0, totalEntries * sizeof(int64_t));
+    memset(batch->totalCPUBursts, 0, totalEntries * sizeof(uint64_t));
+    memset(batch->currentCPUTimeRun, 0, totalEntries * sizeof(uint64_t));
+    memset(batch->currentIOBlockedTime, 0, totalEntries * sizeof(uint64_t));
+    memset(batch->currentWaitingTime, 0, totalEntries * sizeof(uint64_t));
+    size_t entry = 0;
+    for (; entry < totalEntries; ++entry)
+    {
+        batch->quantum[entry] = DEFAULT_ROUND_ROBIN_QUANTUM;
+        batch->finishingTime[entry] = UINT64_MAX;
+    }
+} // End of the reset scheduler batch function
+
+/**
+ * Simulates a single cycle of every lane still running in a block, in the same order of steps as stepScheduler()
+ * @return The number of lanes of the block still running
+ */
+static uint32_t stepBatchBlock(struct SchedulerBatch* batch, uint32_t firstSlot)
+{
+    uint32_t slot = firstSlot;
+    for (; slot < firstSlot + BATCH_BLOCK_LANES; ++slot)
+    {
+        struct BatchLane* lane = &batch->lanes[slot];
+        if (!lane->isRunning)
+            continue;
+
+        // Checked before any process terminates this cycle, as those finish after their deadline too
+        if (lane->firstMissCycle == -1)
+            findFirstBatchDeadlineMiss(batch, lane, slot);
+        doBatchRunningProcess(batch, lane, slot);
+        doBatchBlockedProcesses(batch, lane, slot);
+        createBatchProcesses(batch, lane, slot);
+        doBatchReadyProcesses(batch, lane, slot);
+    }
+
+    incrementBatchTimers(batch, firstSlot);
+
+    // Masks out every lane whose last process terminated this cycle
+    uint32_t totalRunningLanes = 0;
+    for (slot = firstSlot; slot < firstSlot + BATCH_BLOCK_LANES; ++slot)
+    {
+        struct BatchLane* lane = &batch->lanes[slot];
+        if (!lane->isRunning)
+            continue;
+        ++lane->currentCycle;
+        if (lane->totalFinishedProcesses == lane->totalProcesses)
+        {
+            lane->isRunning = false;
+            --batch->totalRunningLanes;
+        }
+        else
+            ++totalRunningLanes;
+    }
+    return totalRunningLanes;
+} // End of the step batch block function
+
+/**
+ * Simulates a single cycle of every lane still running
+ */
+bool stepSchedulerBatch(struct SchedulerBatch* batch)
+{
+    if (batch->hasFailed)
+        return false;
+
+    uint32_t firstSlot = 0;
+    for (; firstSlot < batch->laneStride; firstSlot += BATCH_BLOCK_LANES)
+        stepBatchBlock(batch, firstSlot);
+    return (batch->totalRunningLanes != 0) && !batch->hasFailed;
+} // End of the step scheduler batch function
+
+/**
+ * Runs a single lane alone through its own context, for the scheduler algorithms not run in lockstep
+ */
+static bool runBatchLaneAlone(struct SchedulerBatch* batch, uint32_t slot, struct ProcessSpecification workload[])
+{
+    struct BatchLane* lane = &batch->lanes[slot];
+    uint32_t i = 0;
+    for (; i < lane->totalProcesses; ++i)
+    {
+        size_t entry = (size_t) i * batch->laneStride + slot;
+        struct ProcessSpecification specification = {batch->A[entry], batch->B[entry], batch->C[entry],
+                                                      batch->M[entry], batch->D[entry], batch->niceness[entry]};
+        workload[i] = specification;
+    }
+
+    struct SchedulerContext* context = createSchedulerContext(workload, lane->totalProcesses, batch->randomSource,
+                                                              batch->schedulerAlgorithm);
+    if (context == NULL)
+        return false;
+    context->parameters = batch->parameters;
+    if (lane->randomNumberOffset != 0)
+    {
+        // Draws the initial bursts again from the lane's offset
+        context->randomNumberOffset = lane->randomNumberOffset;
+        resetSchedulerContext(context);
+    }
+    runScheduler(context);
+    if (context->failure != 0)
+    {
+        // Only running out of random numbers can fail a run of a fixed workload
+        batch->hasFailed = true;
+        destroySchedulerContext(context);
+        return false;
+    }
+
+    // Copies the results back into the lane
+    for (i = 0; i < lane->totalProcesses; ++i)
+    {
+        size_t entry = (size_t) i * batch->laneStride + slot;
+        const struct Process* process = &context->processContainer[i];
+        batch->status[entry] = process->status;
+        batch->finishingTime[entry] = process->finishingTime;
+        batch->currentCPUTimeRun[entry] = process->currentCPUTimeRun;
+        batch->currentIOBlockedTime[entry] = process->currentIOBlockedTime;
+        batch->currentWaitingTime[entry] = process->currentWaitingTime;
+    }
+    lane->currentCycle = context->currentCycle;
+    lane->totalFinishedProcesses = context->totalFinishedProcesses;
+    lane->totalNumberOfCyclesSpentBlocked = context->totalNumberOfCyclesSpentBlocked;
+    lane->firstMissCycle = context->firstMissCycle;
+    lane->CPUTimeBeforeFirstMiss = context->CPUTimeBeforeFirstMiss;
+    lane->isRunning = false;
+    --batch->totalRunningLanes;
+
+    destroySchedulerContext(context);
+    return true;
+} // End of the run batch lane alone function
+
+/**
+ * Simulates every lane until all of their processes have terminated, a block at a time
+ */
+bool runSchedulerBatch(struct SchedulerBatch* batch)
+{
+    if ((batch->schedulerAlgorithm == 2) || (batch->schedulerAlgorithm == 5))
+    {
+        // UNI and CFS keep state (the suspended queue and run queue tree) that does not fit in lanes, so run alone
+        struct ProcessSpecification* workload = calloc(batch->maximumProcesses + 1, sizeof(struct ProcessSpecification));
+        if (workload == NULL)
+            return false;
+        uint32_t slot = 0;
+        for (; slot < batch->totalLanes; ++slot)
+        {
+            if (batch->lanes[slot].isRunning && !runBatchLaneAlone(batch, slot, workload))
+            {
+                free(workload);
+                return false;
+            }
+        }
+        free(workload);
+        return true;
+    }
+
+    // Runs each block to completion in turn, so that its lanes stay in cache and only wait on each other
+    uint32_t firstSlot = 0;
+    for (; (firstSlot < batch->laneStride) && !batch->hasFailed; firstSlot += BATCH_BLOCK_LANES)
+    {
+        while ((stepBatchBlock(batch, firstSlot) != 0) && !batch->hasFailed);
+    }
+    return !batch->hasFailed;
+} // End of the run scheduler batch function
+
+/**
+ * Retrieves the results of a single process of a lane
+ */
+bool getBatchProcessMetrics(const struct SchedulerBatch* batch, uint32_t lane, uint32_t processID,
+                            struct ProcessMetrics* metrics)
+{
+    if ((lane >= batch->totalLanes) || (processID >= batch->lanes[batch->laneSlots[lane]].totalProcesses))
+        return false;
+
+    size_t entry = (size_t) processID * batch->laneStride + batch->laneSlots[lane];
+    metrics->processID = processID;
+    metrics->A = batch->A[entry];
+    metrics->B = batch->B[entry];
+    metrics->C = batch->C[entry];
+    metrics->M = batch->M[entry];
+    metrics->D = batch->D[entry];
+    metrics->niceness = batch->niceness[entry];
+    metrics->finishingTime = batch->finishingTime[entry];
+    metrics->turnaroundTime = batch->finishingTime[entry] - batch->A[entry];
+    metrics->CPUTime = batch->currentCPUTimeRun[entry];
+    metrics->IOTime = batch->currentIOBlockedTime[entry];
+    metrics->waitingTime = batch->currentWaitingTime[entry];
+    metrics->lateness = (batch->D[entry] == 0) ? 0 :
+            (int64_t) (batch->finishingTime[entry] - getBatchAbsoluteDeadline(batch, entry));
+    return true;
+} // End of the get batch process metrics function
+
+/**
+ * Retrieves the summary results of a lane once the batch has been run, calculated exactly as getSummaryMetrics() does
+ */
+void getBatchSummaryMetrics(const struct SchedulerBatch* batch, uint32_t lane, struct SummaryMetrics* metrics)
+{
+    uint32_t slot = batch->laneSlots[lane];
+    const struct BatchLane* batchLane = &batch->lanes[slot];
+    uint32_t i = 0;
+    double totalAmountOfTimeUtilisingCPU = 0.0;
+    double totalAmountOfTimeSpentWaiting = 0.0;
+    double totalTurnaroundTime = 0.0;
+    double totalProgressRate = 0.0;
+    double totalSquaredProgressRate = 0.0;
+    uint64_t finalFinishingTime = batchLane->currentCycle - 1;
+    for (; i < batchLane->totalProcesses; ++i)
+    {
+        size_t entry = (size_t) i * batch->laneStride + slot;
+        totalAmountOfTimeUtilisingCPU += batch->currentCPUTimeRun[entry];
+        totalAmountOfTimeSpentWaiting += batch->currentWaitingTime[entry];
+        double turnaroundTime = (double) (batch->finishingTime[entry] - batch->A[entry]);
+        totalTurnaroundTime += turnaroundTime;
+
+        double progressRate = (turnaroundTime <= 0) ? 1.0 :
+                ((double) batch->currentCPUTimeRun[entry] + batch->currentIOBlockedTime[entry]) / turnaroundTime;
+        totalProgressRate += progressRate;
+        totalSquaredProgressRate += progressRate * progressRate;
+    }
+
+    metrics->finishingTime = finalFinishingTime;
+    metrics->CPUUtilisation = totalAmountOfTimeUtilisingCPU / (double) finalFinishingTime;
+    metrics->IOUtilisation = (double) batchLane->totalNumberOfCyclesSpentBlocked / (double) finalFinishingTime;
+    metrics->throughput = 100 * ((double) batchLane->totalProcesses / (double) finalFinishingTime);
+    metrics->averageTurnaroundTime = totalTurnaroundTime / batchLane->totalProcesses;
+    metrics->averageWaitingTime = totalAmountOfTimeSpentWaiting / batchLane->totalProcesses;
+    metrics->fairnessIndex = (totalSquaredProgressRate == 0) ? 1.0 :
+            (totalProgressRate * totalProgressRate) / (batchLane->totalProcesses * totalSquaredProgressRate);
+
+    double totalLateness = 0.0;
+    metrics->totalDeadlineMisses = 0;
+    for (i = 0; i < batchLane->totalDeadlineProcesses; ++i)
+    {
+        size_t entry = (size_t) batchLane->deadlineOrder[i] * batch->laneStride + slot;
+        double lateness =
+                (double) (int64_t) (batch->finishingTime[entry] - getBatchAbsoluteDeadline(batch, entry));
+        totalLateness += lateness;
+        if (lateness > 0)
+            ++metrics->totalDeadlineMisses;
+    }
+    metrics->totalDeadlineProcesses = batchLane->totalDeadlineProcesses;
+    metrics->averageLateness = (batchLane->totalDeadlineProcesses == 0) ? 0.0 :
+            totalLateness / batchLane->totalDeadlineProcesses;
+    metrics->firstMissCycle = batchLane->firstMissCycle;
+    metrics->firstMissCPUUtilisation = (batchLane->firstMissCycle <= 0) ? 0.0 :
+            (double) batchLane->CPUTimeBeforeFirstMiss / batchLane->firstMissCycle;
+} // End of the get batch summary metrics function
+
+/************************ END OF BATCH FUNCTIONS *************************************/
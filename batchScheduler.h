@@ -0,0 +1,141 @@
+#ifndef BATCH_SCHEDULER_H
+#define BATCH_SCHEDULER_H
+
+#include <stdint.h>
+
+#include "libscheduler.h"
+
+/*
+ * Simulates many small, independent workloads (lanes) in lockstep, one cycle of every lane at a time, with the same
+ * scheduler algorithm and parameters. Each per process field is held lane-wise, as one array per field with the lanes of
+ * a process side by side, so that the timer updates of every lane run as a single branchless loop the compiler can
+ * vectorise, and a lane whose processes have all terminated simply drops out (its processes no longer change). The
+ * results of each lane are the same as running its workload alone with runScheduler(), with the context's
+ * randomNumberOffset set to the lane's (lanes[laneSlots[lane]].randomNumberOffset).
+ *
+ * FCFS, RR, SJF and EDF are run in lockstep. UNI and CFS fall back to running each lane alone through the scalar
+ * engine. Only the per process and summary results are kept, not the latency distributions or telemetry.
+ */
+
+#define BATCH_NO_PROCESS UINT32_MAX     // The running process of a lane with nothing running
+#define BATCH_BLOCK_LANES 64            // The number of lanes run to completion together by runSchedulerBatch()
+
+/* The scheduler state of a single lane, touched one lane at a time */
+struct BatchLane {
+    uint32_t totalProcesses;            // The number of processes in the lane's workload
+    bool isRunning;                     // false once every process of the lane has terminated
+    uint64_t currentCycle;              // The cycle the lane is on (one past its last cycle once finished)
+
+    uint32_t runningProcess;            // The processID of the running process (BATCH_NO_PROCESS if none)
+    uint32_t* readyQueue;               // The processIDs of the ready processes, in the order they became ready
+    uint32_t readyQueueSize;
+    uint32_t* blockedList;              // The processIDs of the blocked processes, in the order they were blocked
+    uint32_t blockedListSize;
+    uint32_t* arrivalOrder;             // The processIDs sorted by arrival time, then processID
+    uint32_t nextArrivalIndex;          // The first entry of arrivalOrder not yet created
+
+    uint32_t totalFinishedProcesses;
+    uint32_t randomNumberOffset;        // The entry of the random source to start from (0 unless changed before a run)
+    uint32_t randomNumberIndex;         // The number of entries of the random source used so far
+    uint64_t totalNumberOfCyclesSpentBlocked;
+
+    // The processes with a deadline, sorted by absolute deadline, checked off in turn to find the first miss
+    uint32_t* deadlineOrder;
+    uint32_t totalDeadlineProcesses;
+    uint32_t nextDeadlineIndex;
+    int64_t firstMissCycle;             // The cycle the first deadline was missed on (-1 if none have been)
+    uint64_t CPUTimeBeforeFirstMiss;
+};
+
+/*
+ * A batch of workloads simulated together. Each lane is simulated in a slot, with lanes of a similar estimated length
+ * packed into the same block of slots. Lane-wise arrays hold process p of the lane in slot s at [p * laneStride + s].
+ */
+struct SchedulerBatch {
+    uint8_t schedulerAlgorithm;         // 0 = FCFS, 1 = RR, 2 = UNI, 3 = SJF, 4 = EDF, 5 = CFS
+    struct SchedulerParameters parameters; // The defaults unless changed before a run
+    const struct RandomNumberSource* randomSource;
+
+    uint32_t totalLanes;
+    uint32_t maximumProcesses;          // The number of processes in the largest workload
+    uint32_t laneStride;                // totalLanes rounded up to a whole number of blocks of BATCH_BLOCK_LANES
+    uint32_t totalRunningLanes;         // The number of lanes with unfinished processes
+    bool hasFailed;                     // Set once a lane runs out of random numbers, which stops the whole run
+    uint32_t* laneSlots;                // The slot of each lane, in input order
+    struct BatchLane* lanes;            // The state of the lane in each slot
+
+    // The inputs of each process, lane-wise (a lane with fewer processes is padded with processes that never arrive)
+    uint64_t* A;
+    uint64_t* B;
+    uint64_t* C;
+    uint64_t* M;
+    uint64_t* D;
+    int32_t* niceness;
+
+    // The state of each process, lane-wise, as in struct Process
+    uint8_t* status;                    // 0 is unstarted, 1 is ready, 2 is running, 3 is blocked, 4 is terminated
+    uint8_t* isFirstTimeRunning;
+    uint64_t* CPUBurst;
+    int64_t* IOBurst;
+    int64_t* quantum;
+    uint64_t* totalCPUBursts;
+    uint64_t* currentCPUTimeRun;
+    uint64_t* currentIOBlockedTime;
+    uint64_t* currentWaitingTime;
+    uint64_t* finishingTime;
+
+    uint32_t* laneQueues;               // The ready queue, blocked list, deadline and arrival order of every lane
+    uint8_t* isLaneBlocked;             // Scratch space, whether each lane has a blocked process this cycle
+};
+
+/**
+ * Creates a batch of workloads, ready to be run from cycle 0, with the default parameters
+ * @param workloads The processes of each lane, in input order
+ * @param totalProcesses The number of processes in each lane's workload
+ * @param totalLanes The number of workloads
+ * @param randomSource The random numbers to use, the same for every lane, which must outlive the batch
+ * @param schedulerAlgorithm Which scheduler algorithm to run. 0 = FCFS, 1 = RR, 2 = UNI, 3 = SJF, 4 = EDF, 5 = CFS.
+ * @return The new batch, or NULL if out of memory
+ */
+struct SchedulerBatch* createSchedulerBatch(const struct ProcessSpecification* const workloads[],
+                                            const uint32_t totalProcesses[], uint32_t totalLanes,
+                                            const struct RandomNumberSource* randomSource, uint8_t schedulerAlgorithm);
+
+/**
+ * Releases a batch created with createSchedulerBatch()
+ */
+void destroySchedulerBatch(struct SchedulerBatch* batch);
+
+/**
+ * Resets every lane so that the batch can be run again from cycle 0
+ */
+void resetSchedulerBatch(struct SchedulerBatch* batch);
+
+/**
+ * Simulates a single cycle of every lane still running (FCFS, RR, SJF and EDF only)
+ * @return true while any lane has unfinished processes, false once none have, or once a lane has run out of random
+ * numbers (see hasFailed)
+ */
+bool stepSchedulerBatch(struct SchedulerBatch* batch);
+
+/**
+ * Simulates every lane until all of their processes have terminated, a block of BATCH_BLOCK_LANES lanes at a time so
+ * that a long workload only holds up the lanes beside it
+ * @return false if out of memory (only possible for UNI and CFS, which run each lane through its own context), or if a
+ * lane runs out of random numbers, either of which leaves the results incomplete
+ */
+bool runSchedulerBatch(struct SchedulerBatch* batch);
+
+/**
+ * Retrieves the results of a single process of a lane, as getProcessMetrics() does for a context
+ * @return false if there is no such lane or process
+ */
+bool getBatchProcessMetrics(const struct SchedulerBatch* batch, uint32_t lane, uint32_t processID,
+                            struct ProcessMetrics* metrics);
+
+/**
+ * Retrieves the summary results of a lane once the batch has been run, as getSummaryMetrics() does for a context
+ */
+void getBatchSummaryMetrics(const struct SchedulerBatch* batch, uint32_t lane, struct SummaryMetrics* metrics);
+
+#endif // BATCH_SCHEDULER_H
@@ -1,2 +1,17 @@
-gcc scheduler.c -o scheduler
+gcc -c libscheduler.c reportWriter.c latencyHistogram.c telemetry.c monteCarlo.c autoTuner.c submissionQueue.c batchScheduler.c resultCache.c traceImporter.c
+ar rcs libscheduler.a libscheduler.o reportWriter.o latencyHistogram.o telemetry.o monteCarlo.o autoTuner.o submissionQueue.o batchScheduler.o resultCache.o traceImporter.o
+gcc scheduler.c -L. -lscheduler -lpthread -lm -o scheduler
+gcc workloadGenerator.c -lm -o workloadGenerator
+gcc differentialTester.c -L. -lscheduler -lpthread -lm -o differentialTester
+./differentialTester --workloads 200
+./differentialTester --workloads 200 --random-numbers random-numbers
 ./scheduler --random --verbose  testing/input/input-7
+./scheduler --sweep --cfs testing/input/input-*
+./scheduler testing/input/input-8 > input-8-output
+cat testing/output/normal/fcfs-output-8 testing/output/normal/rr-output-8 testing/output/normal/uni-output-8 testing/output/normal/sjf-output-8 | diff - input-8-output
+./scheduler --verbose testing/input/input-8 > input-8-output
+cat testing/output/detailed/fcfs-output-8-detailed testing/output/detailed/rr-output-8-detailed testing/output/detailed/uni-output-8-detailed testing/output/detailed/sjf-output-8-detailed | diff - input-8-output
+./scheduler testing/input/input-9 > input-9-output
+cat testing/output/normal/fcfs-output-9 testing/output/normal/rr-output-9 testing/output/normal/uni-output-9 testing/output/normal/sjf-output-9 testing/output/normal/edf-output-9 | diff - input-9-output
+./scheduler testing/input/input-10 > input-10-output
+cat testing/output/normal/fcfs-output-10 testing/output/normal/rr-output-10 testing/output/normal/uni-output-10 testing/output/normal/sjf-output-10 testing/output/normal/edf-output-10 testing/output/normal/cfs-output-10 | diff - input-10-output
@@ -0,0 +1,1035 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "libscheduler.h"
+#include "batchScheduler.h"
+#include "reportWriter.h"
+
+/*
+ * Checks the faster engines against the reference engine, which is the plain tick loop: stepScheduler() once per cycle,
+ * with isEventDriven false. Random workloads are run through the reference engine and through each faster engine side
+ * by side:
+ *  - the event driven engine (skipIdleCycles() then stepScheduler(), as runScheduler() does), under every algorithm
+ *  - the lockstep batch engine (stepSchedulerBatch()), under FCFS, RR, SJF and EDF, with many workloads to a batch
+ *  - the batch engine run end to end (runSchedulerBatch()), under every algorithm, with each lane starting from its own
+ *    random number offset (UNI and CFS lanes are run alone, so only the final results of a lane can be compared)
+ * The state of every process and queue is compared before every cycle that both engines reach (the event driven engine
+ * jumps over idle cycles, so it is compared on the cycle it lands on), or the results once both have finished for a
+ * batch run end to end. The first divergence is then shrunk to a minimal workload that still diverges, by dropping
+ * processes and lowering each value in turn, and printed in the input format.
+ */
+
+#define NO_PROCESS UINT32_MAX           // The running process of a simulation with nothing running
+#define DIFFERENCE_LENGTH 512           // The longest description of a divergence
+#define TESTER_BATCH_LANES 256          // The number of workloads run through each batch
+
+/* The state of a single process before a cycle, as compared between engines */
+struct ProcessState {
+    uint8_t status;                     // 0 is unstarted, 1 is ready, 2 is running, 3 is blocked, 4 is terminated
+    uint64_t CPUBurst;                  // Only compared once a burst has been drawn (see totalCPUBursts)
+    int64_t IOBurst;                    // Only compared while blocked, as it is otherwise left over from a past burst
+    int64_t quantum;
+    uint64_t totalCPUBursts;
+    uint64_t currentCPUTimeRun;
+    uint64_t currentIOBlockedTime;
+    uint64_t currentWaitingTime;
+    uint64_t finishingTime;
+    uint64_t vruntime;
+};
+
+/* The state of a whole simulation before a cycle, with each queue as processIDs */
+struct SimulationState {
+    uint64_t currentCycle;
+    uint32_t runningProcess;            // NO_PROCESS if nothing is running
+    uint32_t totalFinishedProcesses;
+    uint32_t randomNumberIndex;
+    uint64_t totalNumberOfCyclesSpentBlocked;
+    int64_t firstMissCycle;
+    uint64_t CPUTimeBeforeFirstMiss;
+
+    uint32_t totalProcesses;
+    struct ProcessState* processes;
+    uint32_t* readyQueue;               // In the order the processes would be dispatched, ignoring SJF
+    uint32_t readyQueueSize;
+    uint32_t* readySuspendedQueue;
+    uint32_t readySuspendedQueueSize;
+    uint32_t* blockedList;
+    uint32_t blockedListSize;
+};
+
+/* A single run to check: the engine checked against the reference engine, and how both are set up */
+struct TestConfiguration {
+    uint8_t engine;                     // 0 is the event driven engine, 1 is the lockstep batch engine, 2 is a batch run
+    uint8_t schedulerAlgorithm;         // 0 = FCFS, 1 = RR, 2 = UNI, 3 = SJF, 4 = EDF, 5 = CFS
+    struct SchedulerParameters parameters;
+    const struct RandomNumberSource* randomSource;
+    uint32_t randomNumberOffset;        // The entry of the random number file a single workload starts from
+};
+
+/* Where the reference engine and a faster engine first differed */
+struct Divergence {
+    uint64_t cycle;                     // The state differed before this cycle (or the results, once run to it)
+    char difference[DIFFERENCE_LENGTH]; // Which value differed, and how
+};
+
+/* The names of the engines checked against the reference engine, by engine number */
+const char* ENGINE_NAMES[] = {"event driven", "batch", "batch run"};
+
+/* The state of the sequential random number generator (splitmix64) */
+uint64_t GENERATOR_STATE = 0;
+uint64_t TOTAL_CYCLES_COMPARED = 0;     // The number of cycles whose state has been compared so far
+
+/************************ START OF STATE CAPTURE FUNCTIONS *************************************/
+
+/**
+ * Retrieves the absolute deadline of a process, with processes without a deadline coming after every other
+ */
+uint64_t getDeadline(uint64_t A, uint64_t D)
+{
+    return (D == 0) ? UINT64_MAX : A + D;
+} // End of the get deadline function
+
+/**
+ * Allocates the process and queue arrays of a state, with room for a number of processes
+ */
+void allocateSimulationState(struct SimulationState* state, uint32_t processCapacity)
+{
+    state->processes = calloc(processCapacity + 1, sizeof(struct ProcessState));
+    state->readyQueue = calloc(processCapacity + 1, sizeof(uint32_t));
+    state->readySuspendedQueue = calloc(processCapacity + 1, sizeof(uint32_t));
+    state->blockedList = calloc(processCapacity + 1, sizeof(uint32_t));
+    if ((state->processes == NULL) || (state->readyQueue == NULL) || (state->readySuspendedQueue == NULL)
+        || (state->blockedList == NULL))
+    {
+        fprintf(stderr, "Error: out of memory!\n");
+        exit(1);
+    }
+} // End of the allocate simulation state function
+
+/**
+ * Releases the arrays of a state
+ */
+void freeSimulationState(struct SimulationState* state)
+{
+    free(state->processes);
+    free(state->readyQueue);
+    free(state->readySuspendedQueue);
+    free(state->blockedList);
+} // End of the free simulation state function
+
+/**
+ * Appends the processes of a context's CFS run queue tree to the ready queue of a state, lowest vruntime first
+ */
+void appendRunQueue(const struct Process* node, struct SimulationState* state)
+{
+    if (node == NULL)
+        return;
+    appendRunQueue(node->runQueueLeft, state);
+    state->readyQueue[state->readyQueueSize++] = node->processID;
+    appendRunQueue(node->runQueueRight, state);
+} // End of the append run queue function
+
+/**
+ * Captures the state of a context, before its current cycle
+ */
+void captureContextState(const struct SchedulerContext* context, struct SimulationState* state)
+{
+    state->currentCycle = context->currentCycle;
+    state->runningProcess = (context->currentRunningProcess == NULL) ? NO_PROCESS :
+            context->currentRunningProcess->processID;
+    state->totalFinishedProcesses = context->totalFinishedProcesses;
+    state->randomNumberIndex = context->randomNumberIndex;
+    state->totalNumberOfCyclesSpentBlocked = context->totalNumberOfCyclesSpentBlocked;
+    state->firstMissCycle = context->firstMissCycle;
+    state->CPUTimeBeforeFirstMiss = context->CPUTimeBeforeFirstMiss;
+
+    state->totalProcesses = context->totalCreatedProcesses;
+    uint32_t i = 0;
+    for (; i < context->totalCreatedProcesses; ++i)
+    {
+        const struct Process* process = &context->processContainer[i];
+        struct ProcessState* processState = &state->processes[i];
+        processState->status = process->status;
+        processState->CPUBurst = process->CPUBurst;
+        processState->IOBurst = process->IOBurst;
+        processState->quantum = process->quantum;
+        processState->totalCPUBursts = process->totalCPUBursts;
+        processState->currentCPUTimeRun = process->currentCPUTimeRun;
+        processState->currentIOBlockedTime = process->currentIOBlockedTime;
+        processState->currentWaitingTime = process->currentWaitingTime;
+        processState->finishingTime = process->finishingTime;
+        processState->vruntime = process->vruntime;
+    }
+
+    state->readyQueueSize = 0;
+    if (context->schedulerAlgorithm == 4)
+    {
+        // Sorts the EDF heap by deadline, then by the order the processes became ready, as it dispatches them
+        for (i = 0; i < context->readyProcessQueueSize; ++i)
+        {
+            const struct Process* process = context->readyHeap[i];
+            uint32_t position = i;
+            while (position != 0)
+            {
+                const struct Process* previous = &context->processContainer[state->readyQueue[position - 1]];
+                uint64_t deadline = getDeadline(process->A, process->D);
+                uint64_t previousDeadline = getDeadline(previous->A, previous->D);
+                if ((previousDeadline < deadline)
+                    || ((previousDeadline == deadline) && (previous->readySequence < process->readySequence)))
+                    break;
+                state->readyQueue[position] = state->readyQueue[position - 1];
+                --position;
+            }
+            state->readyQueue[position] = process->processID;
+        }
+        state->readyQueueSize = context->readyProcessQueueSize;
+    }
+    else if (context->schedulerAlgorithm == 5)
+        appendRunQueue(context->runQueueRoot, state);
+    else
+    {
+        const struct Process* currentNode = context->readyHead;
+        for (i = 0; i < context->readyProcessQueueSize; ++i, currentNode = currentNode->nextInReadyQueue)
+            state->readyQueue[state->readyQueueSize++] = currentNode->processID;
+    }
+
+    state->readySuspendedQueueSize = 0;
+    const struct Process* currentNode = context->readySuspendedHead;
+    for (i = 0; i < context->readySuspendedProcessQueueSize; ++i, currentNode = currentNode->nextInReadySuspendedQueue)
+        state->readySuspendedQueue[state->readySuspendedQueueSize++] = currentNode->processID;
+
+    state->blockedListSize = 0;
+    for (currentNode = context->blockedHead; currentNode != NULL; currentNode = currentNode->nextInBlockedList)
+        state->blockedList[state->blockedListSize++] = currentNode->processID;
+} // End of the capture context state function
+
+/**
+ * Captures the state of a single lane of a batch, before its current cycle
+ */
+void captureLaneState(const struct SchedulerBatch* batch, uint32_t lane, struct SimulationState* state)
+{
+    uint32_t slot = batch->laneSlots[lane];
+    const struct BatchLane* batchLane = &batch->lanes[slot];
+    state->currentCycle = batchLane->currentCycle;
+    state->runningProcess = (batchLane->runningProcess == BATCH_NO_PROCESS) ? NO_PROCESS : batchLane->runningProcess;
+    state->totalFinishedProcesses = batchLane->totalFinishedProcesses;
+    state->randomNumberIndex = batchLane->randomNumberIndex;
+    state->totalNumberOfCyclesSpentBlocked = batchLane->totalNumberOfCyclesSpentBlocked;
+    state->firstMissCycle = batchLane->firstMissCycle;
+    state->CPUTimeBeforeFirstMiss = batchLane->CPUTimeBeforeFirstMiss;
+
+    state->totalProcesses = batchLane->totalProcesses;
+    uint32_t i = 0;
+    for (; i < batchLane->totalProcesses; ++i)
+    {
+        size_t entry = (size_t) i * batch->laneStride + slot;
+        struct ProcessState* processState = &state->processes[i];
+        processState->status = batch->status[entry];
+        processState->CPUBurst = batch->CPUBurst[entry];
+        processState->IOBurst = batch->IOBurst[entry];
+        processState->quantum = batch->quantum[entry];
+        processState->totalCPUBursts = batch->totalCPUBursts[entry];
+        processState->currentCPUTimeRun = batch->currentCPUTimeRun[entry];
+        processState->currentIOBlockedTime = batch->currentIOBlockedTime[entry];
+        processState->currentWaitingTime = batch->currentWaitingTime[entry];
+        processState->finishingTime = batch->finishingTime[entry];
+        processState->vruntime = 0;
+    }
+
+    // The ready queue is kept in the order the processes became ready, which EDF sorts by deadline (keeping ties in order)
+    for (i = 0; i < batchLane->readyQueueSize; ++i)
+    {
+        uint32_t processID = batchLane->readyQueue[i];
+        size_t entry = (size_t) processID * batch->laneStride + slot;
+        uint32_t position = i;
+        while ((position != 0) && (batch->schedulerAlgorithm == 4))
+        {
+            size_t previousEntry = (size_t) state->readyQueue[position - 1] * batch->laneStride + slot;
+            if (getDeadline(batch->A[previousEntry], batch->D[previousEntry]) <= getDeadline(batch->A[entry], batch->D[entry]))
+                break;
+            state->readyQueue[position] = state->readyQueue[position - 1];
+            --position;
+        }
+        state->readyQueue[position] = processID;
+    }
+    state->readyQueueSize = batchLane->readyQueueSize;
+    state->readySuspendedQueueSize = 0;
+    memcpy(state->blockedList, batchLane->blockedList, batchLane->blockedListSize * sizeof(uint32_t));
+    state->blockedListSize = batchLane->blockedListSize;
+} // End of the capture lane state function
+
+/************************ END OF STATE CAPTURE FUNCTIONS *************************************/
+
+/************************ START OF COMPARISON FUNCTIONS *************************************/
+
+/**
+ * Compares a single value of the two states, describing it if it differs
+ * @param processID The process the value belongs to (NO_PROCESS for a value of the whole simulation)
+ * @return true if the values are the same
+ */
+bool isSameValue(const char* name, uint32_t processID, int64_t referenceValue, int64_t candidateValue,
+                 uint8_t engine, char difference[])
+{
+    if (referenceValue == candidateValue)
+        return true;
+    if (processID == NO_PROCESS)
+        snprintf(difference, DIFFERENCE_LENGTH, "%s is %" PRId64 " in the reference engine, but %" PRId64
+                 " in the %s engine", name, referenceValue, candidateValue, ENGINE_NAMES[engine]);
+    else
+        snprintf(difference, DIFFERENCE_LENGTH, "process %u %s is %" PRId64 " in the reference engine, but %" PRId64
+                 " in the %s engine", processID, name, referenceValue, candidateValue, ENGINE_NAMES[engine]);
+    return false;
+} // End of the is same value function
+
+/**
+ * Compares a single result of the two engines that is not a whole number, describing it if it differs
+ * @return true if the values are exactly the same, as both engines calculate them in the same way
+ */
+bool isSameFraction(const char* name, double referenceValue, double candidateValue, uint8_t engine, char difference[])
+{
+    if (referenceValue == candidateValue)
+        return true;
+    snprintf(difference, DIFFERENCE_LENGTH, "%s is %f in the reference engine, but %f in the %s engine", name,
+             referenceValue, candidateValue, ENGINE_NAMES[engine]);
+    return false;
+} // End of the is same fraction function
+
+/**
+ * Writes out a queue of processIDs, e.g. "[2 0 1]"
+ */
+int writeQueue(char* text, size_t length, const uint32_t queue[], uint32_t queueSize)
+{
+    int written = snprintf(text, length, "[");
+    uint32_t i = 0;
+    for (; (i < queueSize) && ((size_t) written < length); ++i)
+        written += snprintf(text + written, length - written, (i == 0) ? "%u" : " %u", queue[i]);
+    if ((size_t) written < length)
+        written += snprintf(text + written, length - written, "]");
+    return written;
+} // End of the write queue function
+
+/**
+ * Compares a queue of the two states, describing it if it differs
+ * @return true if the queues hold the same processes in the same order
+ */
+bool isSameQueue(const char* name, const uint32_t referenceQueue[], uint32_t referenceQueueSize,
+                 const uint32_t candidateQueue[], uint32_t candidateQueueSize, uint8_t engine, char difference[])
+{
+    if ((referenceQueueSize == candidateQueueSize)
+        && (memcmp(referenceQueue, candidateQueue, referenceQueueSize * sizeof(uint32_t)) == 0))
+        return true;
+
+    int written = snprintf(difference, DIFFERENCE_LENGTH, "the %s is ", name);
+    written += writeQueue(difference + written, DIFFERENCE_LENGTH - written, referenceQueue, referenceQueueSize);
+    if (written < DIFFERENCE_LENGTH)
+        written += snprintf(difference + written, DIFFERENCE_LENGTH - written, " in the reference engine, but ");
+    if (written < DIFFERENCE_LENGTH)
+        written += writeQueue(difference + written, DIFFERENCE_LENGTH - written, candidateQueue, candidateQueueSize);
+    if (written < DIFFERENCE_LENGTH)
+        snprintf(difference + written, DIFFERENCE_LENGTH - written, " in the %s engine", ENGINE_NAMES[engine]);
+    return false;
+} // End of the is same queue function
+
+/**
+ * Compares the state of the reference engine with that of a faster engine, before the same cycle
+ * @return true if they are the same, otherwise false with the first difference described in the divergence
+ */
+bool isSameState(const struct SimulationState* reference, const struct SimulationState* candidate, uint8_t engine,
+                 struct Divergence* divergence)
+{
+    char* difference = divergence->difference;
+    divergence->cycle = reference->currentCycle;
+    ++TOTAL_CYCLES_COMPARED;
+
+    // The cycles are compared first, as a faster engine that finished early (or late) differs in everything else too
+    if (!isSameValue("the cycle", NO_PROCESS, (int64_t) reference->currentCycle, (int64_t) candidate->currentCycle,
+                     engine, difference)
+        || !isSameValue("the number of finished processes", NO_PROCESS, reference->totalFinishedProcesses,
+                        candidate->totalFinishedProcesses, engine, difference))
+        return false;
+    if (reference->runningProcess != candidate->runningProcess)
+    {
+        // Written as a queue of at most one process, so that nothing running shows as "[]"
+        return isSameQueue("running process", &reference->runningProcess, reference->runningProcess != NO_PROCESS,
+                           &candidate->runningProcess, candidate->runningProcess != NO_PROCESS, engine, difference);
+    }
+
+    uint32_t i = 0;
+    for (; i < reference->totalProcesses; ++i)
+    {
+        const struct ProcessState* referenceProcess = &reference->processes[i];
+        const struct ProcessState* candidateProcess = &candidate->processes[i];
+        if (!isSameValue("status", i, referenceProcess->status, candidateProcess->status, engine, difference)
+            || !isSameValue("totalCPUBursts", i, (int64_t) referenceProcess->totalCPUBursts,
+                            (int64_t) candidateProcess->totalCPUBursts, engine, difference)
+            || ((referenceProcess->totalCPUBursts != 0)
+                && !isSameValue("CPUBurst", i, (int64_t) referenceProcess->CPUBurst,
+                                (int64_t) candidateProcess->CPUBurst, engine, difference))
+            || ((referenceProcess->status == 3)
+                && !isSameValue("IOBurst", i, referenceProcess->IOBurst, candidateProcess->IOBurst, engine, difference))
+            || !isSameValue("quantum", i, referenceProcess->quantum, candidateProcess->quantum, engine, difference)
+            || !isSameValue("CPU time", i, (int64_t) referenceProcess->currentCPUTimeRun,
+                            (int64_t) candidateProcess->currentCPUTimeRun, engine, difference)
+            || !isSameValue("I/O time", i, (int64_t) referenceProcess->currentIOBlockedTime,
+                            (int64_t) candidateProcess->currentIOBlockedTime, engine, difference)
+            || !isSameValue("waiting time", i, (int64_t) referenceProcess->currentWaitingTime,
+                            (int64_t) candidateProcess->currentWaitingTime, engine, difference)
+            || !isSameValue("finishing time", i, (int64_t) referenceProcess->finishingTime,
+                            (int64_t) candidateProcess->finishingTime, engine, difference)
+            || !isSameValue("vruntime", i, (int64_t) referenceProcess->vruntime, (int64_t) candidateProcess->vruntime,
+                            engine, difference))
+            return false;
+    }
+
+    return isSameQueue("ready queue", reference->readyQueue, reference->readyQueueSize, candidate->readyQueue,
+                       candidate->readyQueueSize, engine, difference)
+           && isSameQueue("ready suspended queue", reference->readySuspendedQueue, reference->readySuspendedQueueSize,
+                          candidate->readySuspendedQueue, candidate->readySuspendedQueueSize, engine, difference)
+           && isSameQueue("blocked list", reference->blockedList, reference->blockedListSize, candidate->blockedList,
+                          candidate->blockedListSize, engine, difference)
+           && isSameValue("the number of random numbers used", NO_PROCESS, reference->randomNumberIndex,
+                          candidate->randomNumberIndex, engine, difference)
+           && isSameValue("the number of cycles spent blocked", NO_PROCESS,
+                          (int64_t) reference->totalNumberOfCyclesSpentBlocked,
+                          (int64_t) candidate->totalNumberOfCyclesSpentBlocked, engine, difference)
+           && isSameValue("the first deadline miss", NO_PROCESS, reference->firstMissCycle, candidate->firstMissCycle,
+                          engine, difference)
+           && isSameValue("the CPU time before the first deadline miss", NO_PROCESS,
+                          (int64_t) reference->CPUTimeBeforeFirstMiss, (int64_t) candidate->CPUTimeBeforeFirstMiss,
+                          engine, difference);
+} // End of the is same state function
+
+/**
+ * Compares the results of a finished reference engine with those of a lane of a finished batch
+ * @return true if they are the same, otherwise false with the first difference described in the divergence
+ */
+bool isSameResults(const struct SchedulerContext* reference, const struct SchedulerBatch* batch, uint32_t lane,
+                   uint8_t engine, struct Divergence* divergence)
+{
+    char* difference = divergence->difference;
+    divergence->cycle = reference->currentCycle;
+    uint32_t i = 0;
+    for (; i < reference->totalCreatedProcesses; ++i)
+    {
+        struct ProcessMetrics referenceMetrics;
+        struct ProcessMetrics candidateMetrics;
+        getProcessMetrics(reference, i, &referenceMetrics);
+        getBatchProcessMetrics(batch, lane, i, &candidateMetrics);
+        if (!isSameValue("finishing time", i, (int64_t) referenceMetrics.finishingTime,
+                         (int64_t) candidateMetrics.finishingTime, engine, difference)
+            || !isSameValue("CPU time", i, (int64_t) referenceMetrics.CPUTime, (int64_t) candidateMetrics.CPUTime,
+                            engine, difference)
+            || !isSameValue("I/O time", i, (int64_t) referenceMetrics.IOTime, (int64_t) candidateMetrics.IOTime,
+                            engine, difference)
+            || !isSameValue("waiting time", i, (int64_t) referenceMetrics.waitingTime,
+                            (int64_t) candidateMetrics.waitingTime, engine, difference)
+            || !isSameValue("lateness", i, referenceMetrics.lateness, candidateMetrics.lateness, engine, difference))
+            return false;
+    }
+
+    struct SummaryMetrics referenceSummary;
+    struct SummaryMetrics candidateSummary;
+    getSummaryMetrics(reference, &referenceSummary);
+    getBatchSummaryMetrics(batch, lane, &candidateSummary);
+    return isSameValue("the finishing time", NO_PROCESS, (int64_t) referenceSummary.finishingTime,
+                       (int64_t) candidateSummary.finishingTime, engine, difference)
+           && isSameFraction("the CPU utilisation", referenceSummary.CPUUtilisation, candidateSummary.CPUUtilisation,
+                             engine, difference)
+           && isSameFraction("the I/O utilisation", referenceSummary.IOUtilisation, candidateSummary.IOUtilisation,
+                             engine, difference)
+           && isSameFraction("the fairness index", referenceSummary.fairnessIndex, candidateSummary.fairnessIndex,
+                             engine, difference)
+           && isSameValue("the number of deadline misses", NO_PROCESS, referenceSummary.totalDeadlineMisses,
+                          candidateSummary.totalDeadlineMisses, engine, difference)
+           && isSameValue("the first deadline miss", NO_PROCESS, referenceSummary.firstMissCycle,
+                          candidateSummary.firstMissCycle, engine, difference)
+           && isSameFraction("the CPU utilisation before the first deadline miss",
+                             referenceSummary.firstMissCPUUtilisation, candidateSummary.firstMissCPUUtilisation, engine,
+                             difference);
+} // End of the is same results function
+
+/************************ END OF COMPARISON FUNCTIONS *************************************/
+
+/************************ START OF ENGINE CHECKING FUNCTIONS *************************************/
+
+/**
+ * Creates a context running the reference engine, or the event driven engine
+ */
+struct SchedulerContext* createTestContext(const struct ProcessSpecification workload[], uint32_t totalProcesses,
+                                           const struct TestConfiguration* configuration, bool isEventDriven)
+{
+    struct SchedulerContext* context = createSchedulerContext(workload, totalProcesses, configuration->randomSource,
+                                                              configuration->schedulerAlgorithm);
+    if (context == NULL)
+    {
+        fprintf(stderr, "Error: out of memory!\n");
+        exit(1);
+    }
+    context->parameters = configuration->parameters;
+    context->isEventDriven = isEventDriven;
+    if (configuration->randomNumberOffset != 0)
+    {
+        // Draws the initial bursts again from the offset
+        context->randomNumberOffset = configuration->randomNumberOffset;
+        resetSchedulerContext(context);
+    }
+    return context;
+} // End of the create test context function
+
+/**
+ * Steps the reference engine up to the given cycle, or until it finishes
+ */
+void advanceReferenceEngine(struct SchedulerContext* reference, uint64_t cycle)
+{
+    bool isStillRunning = true;
+    while (isStillRunning && (reference->currentCycle < cycle))
+        isStillRunning = stepScheduler(reference);
+} // End of the advance reference engine function
+
+/**
+ * Runs a workload through the reference engine and the event driven engine side by side, comparing them before every
+ * cycle the event driven engine reaches
+ * @return true if they never differ, otherwise false with the divergence filled in
+ */
+bool checkEventDrivenEngine(const struct ProcessSpecification workload[], uint32_t totalProcesses,
+                            const struct TestConfiguration* configuration, struct Divergence* divergence)
+{
+    struct SchedulerContext* reference = createTestContext(workload, totalProcesses, configuration, false);
+    struct SchedulerContext* candidate = createTestContext(workload, totalProcesses, configuration, true);
+    struct SimulationState referenceState;
+    struct SimulationState candidateState;
+    allocateSimulationState(&referenceState, totalProcesses);
+    allocateSimulationState(&candidateState, totalProcesses);
+
+    bool isSame = true;
+    bool isStillRunning = true;
+    while (isSame && isStillRunning)
+    {
+        // Compares after skipping over idle cycles, and then after the cycle that follows them
+        if (skipIdleCycles(candidate) != 0)
+        {
+            advanceReferenceEngine(reference, candidate->currentCycle);
+            captureContextState(reference, &referenceState);
+            captureContextState(candidate, &candidateState);
+            isSame = isSameState(&referenceState, &candidateState, configuration->engine, divergence);
+            if (!isSame)
+                break;
+        }
+
+        isStillRunning = stepScheduler(candidate);
+        advanceReferenceEngine(reference, candidate->currentCycle);
+        captureContextState(reference, &referenceState);
+        captureContextState(candidate, &candidateState);
+        isSame = isSameState(&referenceState, &candidateState, configuration->engine, divergence);
+    }
+
+    freeSimulationState(&referenceState);
+    freeSimulationState(&candidateState);
+    destroySchedulerContext(reference);
+    destroySchedulerContext(candidate);
+    return isSame;
+} // End of the check event driven engine function
+
+/**
+ * Runs many workloads through the lockstep batch engine, and each through its own reference engine alongside it,
+ * comparing every lane with its reference engine before every cycle
+ * @param divergentLane Set to the lane that differed, if any did
+ * @return true if none of them ever differ, otherwise false with the divergence filled in
+ */
+bool checkBatchEngine(const struct ProcessSpecification* const workloads[], const uint32_t totalProcesses[],
+                      uint32_t totalLanes, const struct TestConfiguration* configuration, struct Divergence* divergence,
+                      uint32_t* divergentLane)
+{
+    struct SchedulerContext** references = calloc(totalLanes + 1, sizeof(struct SchedulerContext*));
+    bool* isReferenceRunning = calloc(totalLanes + 1, sizeof(bool));
+    struct SchedulerBatch* batch = createSchedulerBatch(workloads, totalProcesses, totalLanes,
+                                                        configuration->randomSource, configuration->schedulerAlgorithm);
+    if ((references == NULL) || (isReferenceRunning == NULL) || (batch == NULL))
+    {
+        fprintf(stderr, "Error: out of memory!\n");
+        exit(1);
+    }
+    batch->parameters = configuration->parameters;
+
+    uint32_t maximumProcesses = 0;
+    uint32_t lane = 0;
+    for (; lane < totalLanes; ++lane)
+    {
+        references[lane] = createTestContext(workloads[lane], totalProcesses[lane], configuration, false);
+        isReferenceRunning[lane] = true;
+        if (totalProcesses[lane] > maximumProcesses)
+            maximumProcesses = totalProcesses[lane];
+    }
+    struct SimulationState referenceState;
+    struct SimulationState candidateState;
+    allocateSimulationState(&referenceState, maximumProcesses);
+    allocateSimulationState(&candidateState, maximumProcesses);
+
+    // Steps every lane still running in its reference engine, until all of them have finished
+    bool isSame = true;
+    uint32_t totalRunningReferences = totalLanes;
+    while (isSame && (totalRunningReferences != 0))
+    {
+        stepSchedulerBatch(batch);
+        for (lane = 0; (lane < totalLanes) && isSame; ++lane)
+        {
+            if (!isReferenceRunning[lane])
+                continue;
+            isReferenceRunning[lane] = stepScheduler(references[lane]);
+            if (!isReferenceRunning[lane])
+                --totalRunningReferences;
+            captureContextState(references[lane], &referenceState);
+            captureLaneState(batch, lane, &candidateState);
+            isSame = isSameState(&referenceState, &candidateState, configuration->engine, divergence);
+            *divergentLane = lane;
+        }
+    }
+
+    freeSimulationState(&referenceState);
+    freeSimulationState(&candidateState);
+    for (lane = 0; lane < totalLanes; ++lane)
+        destroySchedulerContext(references[lane]);
+    free(references);
+    free(isReferenceRunning);
+    destroySchedulerBatch(batch);
+    return isSame;
+} // End of the check batch engine function
+
+/**
+ * Runs many workloads to completion with runSchedulerBatch(), each lane from its own random number offset, then runs
+ * each through its own reference engine from the same offset, and compares their results
+ * @param divergentLane Set to the lane that differed, if any did
+ * @return true if none of them differ, otherwise false with the divergence filled in
+ */
+bool checkBatchRun(const struct ProcessSpecification* const workloads[], const uint32_t totalProcesses[],
+                   const uint32_t randomNumberOffsets[], uint32_t totalLanes,
+                   const struct TestConfiguration* configuration, struct Divergence* divergence,
+                   uint32_t* divergentLane)
+{
+    struct SchedulerBatch* batch = createSchedulerBatch(workloads, totalProcesses, totalLanes,
+                                                        configuration->randomSource, configuration->schedulerAlgorithm);
+    if (batch == NULL)
+    {
+        fprintf(stderr, "Error: out of memory!\n");
+        exit(1);
+    }
+    batch->parameters = configuration->parameters;
+    uint32_t lane = 0;
+    for (; lane < totalLanes; ++lane)
+        batch->lanes[batch->laneSlots[lane]].randomNumberOffset = randomNumberOffsets[lane];
+    if (!runSchedulerBatch(batch))
+    {
+        fprintf(stderr, "Error: the batch run under %s did not finish!\n",
+                getSchedulerAlgorithmName(configuration->schedulerAlgorithm));
+        exit(1);
+    }
+
+    bool isSame = true;
+    for (lane = 0; (lane < totalLanes) && isSame; ++lane)
+    {
+        struct TestConfiguration laneConfiguration = *configuration;
+        laneConfiguration.randomNumberOffset = randomNumberOffsets[lane];
+        struct SchedulerContext* reference = createTestContext(workloads[lane], totalProcesses[lane],
+                                                               &laneConfiguration, false);
+        advanceReferenceEngine(reference, UINT64_MAX);
+        isSame = isSameResults(reference, batch, lane, configuration->engine, divergence);
+        *divergentLane = lane;
+        destroySchedulerContext(reference);
+    }
+
+    destroySchedulerBatch(batch);
+    return isSame;
+} // End of the check batch run function
+
+/**
+ * Checks a single workload against the reference engine, alone
+ * @return true if the engines never differ, otherwise false with the divergence filled in
+ */
+bool checkWorkload(const struct ProcessSpecification workload[], uint32_t totalProcesses,
+                   const struct TestConfiguration* configuration, struct Divergence* divergence)
+{
+    if (configuration->engine == 0)
+        return checkEventDrivenEngine(workload, totalProcesses, configuration, divergence);
+
+    uint32_t divergentLane = 0;
+    if (configuration->engine == 2)
+        return checkBatchRun(&workload, &totalProcesses, &configuration->randomNumberOffset, 1, configuration,
+                             divergence, &divergentLane);
+    return checkBatchEngine(&workload, &totalProcesses, 1, configuration, divergence, &divergentLane);
+} // End of the check workload function
+
+/************************ END OF ENGINE CHECKING FUNCTIONS *************************************/
+
+/************************ START OF SHRINKING FUNCTIONS *************************************/
+
+/**
+ * Tries each lower value of a single input of the workload (the smallest allowed, then half, then one less), keeping
+ * the first that still diverges
+ * @param value The input to lower, a field of a process of workload
+ * @param minimum The smallest value the input may take
+ * @return true if the input was lowered
+ */
+bool shrinkValue(uint64_t* value, uint64_t minimum, struct ProcessSpecification workload[], uint32_t totalProcesses,
+                 const struct TestConfiguration* configuration, struct Divergence* divergence)
+{
+    uint64_t originalValue = *value;
+    uint64_t candidateValues[3] = {minimum, originalValue / 2, originalValue - 1};
+    uint32_t i = 0;
+    for (; i < 3; ++i)
+    {
+        if ((candidateValues[i] < minimum) || (candidateValues[i] >= originalValue))
+            continue;
+        *value = candidateValues[i];
+        if (!checkWorkload(workload, totalProcesses, configuration, divergence))
+            return true;
+    }
+    *value = originalValue;
+    return false;
+} // End of the shrink value function
+
+/**
+ * Tries each niceness closer to 0 (0, then half, then one closer), keeping the first that still diverges
+ * @return true if the niceness was moved closer to 0
+ */
+bool shrinkNiceness(int32_t* niceness, struct ProcessSpecification workload[], uint32_t totalProcesses,
+                    const struct TestConfiguration* configuration, struct Divergence* divergence)
+{
+    int32_t originalNiceness = *niceness;
+    int32_t candidateNicenesses[3] = {0, originalNiceness / 2, originalNiceness - ((originalNiceness > 0) ? 1 : -1)};
+    uint32_t i = 0;
+    for (; (i < 3) && (originalNiceness != 0); ++i)
+    {
+        if (abs(candidateNicenesses[i]) >= abs(originalNiceness))
+            continue;
+        *niceness = candidateNicenesses[i];
+        if (!checkWorkload(workload, totalProcesses, configuration, divergence))
+            return true;
+    }
+    *niceness = originalNiceness;
+    return false;
+} // End of the shrink niceness function
+
+/**
+ * Tries each smaller parameter used by the scheduler algorithm, keeping the first that still diverges
+ * @return true if a parameter was lowered
+ */
+bool shrinkParameters(const struct ProcessSpecification workload[], uint32_t totalProcesses,
+                      struct TestConfiguration* configuration, struct Divergence* divergence)
+{
+    struct SchedulerParameters originalParameters = configuration->parameters;
+    uint32_t candidate = 0;
+    for (; candidate < 3; ++candidate)
+    {
+        configuration->parameters = originalParameters;
+        if ((configuration->schedulerAlgorithm == 1) && (candidate == 0) && (originalParameters.roundRobinQuantum > 1))
+            configuration->parameters.roundRobinQuantum = originalParameters.roundRobinQuantum - 1;
+        else if ((configuration->schedulerAlgorithm == 5) && (candidate == 1) && (originalParameters.targetLatency > 1))
+            configuration->parameters.targetLatency = originalParameters.targetLatency - 1;
+        else if ((configuration->schedulerAlgorithm == 5) && (candidate == 2)
+                 && (originalParameters.minimumGranularity > 1))
+            configuration->parameters.minimumGranularity = originalParameters.minimumGranularity - 1;
+        else
+            continue;
+        if (!checkWorkload(workload, totalProcesses, configuration, divergence))
+            return true;
+    }
+    configuration->parameters = originalParameters;
+    return false;
+} // End of the shrink parameters function
+
+/**
+ * Shrinks a workload that diverges until no single process can be dropped, and no single input or parameter lowered,
+ * with it still diverging (greedily, so the result is minimal in that sense, though not necessarily the smallest)
+ * @param workload The diverging workload, shrunk in place
+ * @param totalProcesses The number of processes in workload, updated as processes are dropped
+ * @param configuration The run that diverges, whose parameters may also be lowered
+ * @param divergence Set to the divergence of the shrunk workload
+ */
+void shrinkWorkload(struct ProcessSpecification workload[], uint32_t* totalProcesses,
+                    struct TestConfiguration* configuration, struct Divergence* divergence)
+{
+    bool isShrunk = true;
+    while (isShrunk)
+    {
+        isShrunk = false;
+
+        // Drops each process in turn, from the last, keeping the rest in order
+        uint32_t i = *totalProcesses;
+        while ((i-- != 0) && (*totalProcesses > 1))
+        {
+            struct ProcessSpecification droppedProcess = workload[i];
+            memmove(&workload[i], &workload[i + 1], (*totalProcesses - i - 1) * sizeof(struct ProcessSpecification));
+            if (!checkWorkload(workload, *totalProcesses - 1, configuration, divergence))
+            {
+                --*totalProcesses;
+                isShrunk = true;
+                continue;
+            }
+            memmove(&workload[i + 1], &workload[i], (*totalProcesses - i - 1) * sizeof(struct ProcessSpecification));
+            workload[i] = droppedProcess;
+        }
+
+        // Lowers each input of each process, with B and C kept positive, as the engines require
+        for (i = 0; i < *totalProcesses; ++i)
+        {
+            struct ProcessSpecification* process = &workload[i];
+            while (shrinkValue(&process->A, 0, workload, *totalProcesses, configuration, divergence)
+                   || shrinkValue(&process->B, 1, workload, *totalProcesses, configuration, divergence)
+                   || shrinkValue(&process->C, 1, workload, *totalProcesses, configuration, divergence)
+                   || shrinkValue(&process->M, 0, workload, *totalProcesses, configuration, divergence)
+                   || shrinkValue(&process->D, 0, workload, *totalProcesses, configuration, divergence)
+                   || shrinkNiceness(&process->niceness, workload, *totalProcesses, configuration, divergence))
+                isShrunk = true;
+        }
+
+        while (shrinkParameters(workload, *totalProcesses, configuration, divergence))
+            isShrunk = true;
+    }
+
+    // Leaves the divergence as that of the final workload, as the last check may have been of a rejected candidate
+    checkWorkload(workload, *totalProcesses, configuration, divergence);
+} // End of the shrink workload function
+
+/************************ END OF SHRINKING FUNCTIONS *************************************/
+
+/************************ START OF TESTER FUNCTIONS *************************************/
+
+/**
+ * Retrieves the next 64 random bits
+ */
+uint64_t nextRandomBits()
+{
+    uint64_t value = (GENERATOR_STATE += 0x9e3779b97f4a7c15ULL);
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+} // End of the next random bits function
+
+/**
+ * Retrieves a uniformly distributed random integer in the interval [minimum, maximum]
+ */
+uint64_t nextInteger(uint64_t minimum, uint64_t maximum)
+{
+    return minimum + nextRandomBits() % (maximum - minimum + 1);
+} // End of the next integer function
+
+/**
+ * Generates a random workload of 1 to maximumProcesses processes. The values are kept small, so that processes often
+ * arrive, unblock and reach their deadlines on the same cycle, which is where the ordering rules of the engines matter.
+ * @return The number of processes generated
+ */
+uint32_t generateWorkload(struct ProcessSpecification workload[], uint32_t maximumProcesses)
+{
+    uint32_t totalProcesses = (uint32_t) nextInteger(1, maximumProcesses);
+    uint32_t i = 0;
+    for (; i < totalProcesses; ++i)
+    {
+        workload[i].A = nextInteger(0, 4 * (uint64_t) totalProcesses);
+        workload[i].B = nextInteger(1, 8);
+        workload[i].C = nextInteger(1, 24);
+        workload[i].M = nextInteger(0, 3);
+        workload[i].D = (nextInteger(0, 1) == 0) ? 0 : nextInteger(1, 80);
+        workload[i].niceness = (nextInteger(0, 1) == 0) ? 0 : (int32_t) nextInteger(0, 39) - 20;
+    }
+    return totalProcesses;
+} // End of the generate workload function
+
+/**
+ * Draws the parameters of a run, small enough that processes are often preempted
+ */
+void generateParameters(struct SchedulerParameters* parameters)
+{
+    parameters->roundRobinQuantum = (int32_t) nextInteger(1, 6);
+    parameters->targetLatency = (uint32_t) nextInteger(1, 24);
+    parameters->minimumGranularity = (uint32_t) nextInteger(1, 6);
+} // End of the generate parameters function
+
+/**
+ * Prints out a divergence, and the workload that reproduces it, in the input format
+ */
+void printDivergence(const struct ProcessSpecification workload[], uint32_t totalProcesses,
+                     uint32_t originalTotalProcesses, const struct TestConfiguration* configuration,
+                     const struct Divergence* divergence, bool isShrunk)
+{
+    const struct RandomNumberSource* randomSource = configuration->randomSource;
+    printf("The %s engine diverged from the reference engine under %s", ENGINE_NAMES[configuration->engine],
+           getSchedulerAlgorithmName(configuration->schedulerAlgorithm));
+    if (configuration->schedulerAlgorithm == 1)
+        printf(" (quantum %d)", configuration->parameters.roundRobinQuantum);
+    else if (configuration->schedulerAlgorithm == 5)
+        printf(" (target latency %u, minimum granularity %u)", configuration->parameters.targetLatency,
+               configuration->parameters.minimumGranularity);
+    printf(", before cycle %" PRIu64 ":\n\t%s\n", divergence->cycle, divergence->difference);
+
+    if (isShrunk)
+        printf("Shrunk from %u processes to this workload", originalTotalProcesses);
+    else
+        printf("It only diverges alongside the other workloads of its batch, so this workload was not shrunk");
+    if (randomSource->isCounterBased)
+        printf(" (with the random numbers of --seed %" PRIu64 "):\n", randomSource->seed);
+    else
+        printf(" (with the random numbers of the random number file, from entry %u):\n",
+               configuration->randomNumberOffset);
+
+    printf("%u", totalProcesses);
+    uint32_t i = 0;
+    for (; i < totalProcesses; ++i)
+    {
+        const struct ProcessSpecification* process = &workload[i];
+        printf(" (%" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64, process->A, process->B, process->C, process->M);
+        if ((process->D != 0) || (process->niceness != 0))
+            printf(" %" PRIu64, process->D);
+        if (process->niceness != 0)
+            printf(" %d", process->niceness);
+        printf(")");
+    }
+    printf("\n");
+} // End of the print divergence function
+
+/**
+ * Shrinks a diverging workload and prints it out, then exits
+ */
+void reportDivergence(const struct ProcessSpecification originalWorkload[], uint32_t originalTotalProcesses,
+                      const struct TestConfiguration* originalConfiguration, const struct Divergence* divergence)
+{
+    struct ProcessSpecification* workload = calloc(originalTotalProcesses + 1, sizeof(struct ProcessSpecification));
+    if (workload == NULL)
+    {
+        fprintf(stderr, "Error: out of memory!\n");
+        exit(1);
+    }
+    memcpy(workload, originalWorkload, originalTotalProcesses * sizeof(struct ProcessSpecification));
+    struct TestConfiguration configuration = *originalConfiguration;
+
+    // A batch lane may only diverge alongside the other lanes, in which case it cannot be shrunk alone
+    uint32_t totalProcesses = originalTotalProcesses;
+    struct Divergence shrunkDivergence;
+    bool isShrunk = !checkWorkload(workload, totalProcesses, &configuration, &shrunkDivergence);
+    if (isShrunk)
+        shrinkWorkload(workload, &totalProcesses, &configuration, &shrunkDivergence);
+    printDivergence(workload, totalProcesses, originalTotalProcesses, &configuration,
+                    isShrunk ? &shrunkDivergence : divergence, isShrunk);
+    free(workload);
+    exit(1);
+} // End of the report divergence function
+
+/**
+ * Prints out how to run the tester
+ */
+void printUsage(const char* programName)
+{
+    fprintf(stderr, "Usage: %s [--seed <seed>] [--workloads <count>] [--processes <count>] [--random-numbers <file>]\n",
+            programName);
+} // End of the print usage function
+
+/**
+ * Checks the faster engines against the reference engine on random workloads, stopping at the first divergence.
+ * For example run commands, please see the README
+ */
+int main(int argc, char *argv[])
+{
+    uint64_t seed = 0;
+    uint32_t totalWorkloads = 1000;
+    uint32_t maximumProcesses = 8;
+    const char* randomNumberFileName = NULL;
+
+    int32_t i = 1;
+    for (; i < argc; ++i)
+    {
+        bool isValid = true;
+        if ((strcmp(argv[i], "--seed") == 0) && (i + 1 < argc))
+            seed = strtoull(argv[++i], NULL, 0);
+        else if ((strcmp(argv[i], "--workloads") == 0) && (i + 1 < argc))
+            totalWorkloads = (uint32_t) strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--processes") == 0) && (i + 1 < argc))
+            isValid = (maximumProcesses = (uint32_t) strtoul(argv[++i], NULL, 10)) != 0;
+        else if ((strcmp(argv[i], "--random-numbers") == 0) && (i + 1 < argc))
+            randomNumberFileName = argv[++i];
+        else
+            isValid = false;
+
+        // [ERROR CHECKING]: INVALID FLAG
+        if (!isValid)
+        {
+            fprintf(stderr, "Error: invalid argument %s!\n", argv[i]);
+            printUsage(argv[0]);
+            exit(1);
+        }
+    }
+
+    // The random numbers are calculated from the seed, unless a random number file is given
+    struct RandomNumberSource randomSource;
+    if (randomNumberFileName == NULL)
+        initialiseCounterBasedRandomSource(seed, &randomSource);
+    else if (!loadRandomNumberSource(randomNumberFileName, &randomSource))
+    {
+        fprintf(stderr, "Error: could not read the random numbers from %s!\n", randomNumberFileName);
+        exit(1);
+    }
+
+    struct ProcessSpecification* workloads = calloc((size_t) TESTER_BATCH_LANES * maximumProcesses + 1,
+                                                    sizeof(struct ProcessSpecification));
+    const struct ProcessSpecification* laneWorkloads[TESTER_BATCH_LANES];
+    uint32_t totalProcesses[TESTER_BATCH_LANES];
+    uint32_t randomNumberOffsets[TESTER_BATCH_LANES];
+    if (workloads == NULL)
+    {
+        fprintf(stderr, "Error: out of memory!\n");
+        exit(1);
+    }
+
+    // Every run with the same seed and arguments checks the same workloads
+    GENERATOR_STATE = seed;
+    uint32_t firstWorkload = 0;
+    for (; firstWorkload < totalWorkloads; firstWorkload += TESTER_BATCH_LANES)
+    {
+        uint32_t totalLanes = (totalWorkloads - firstWorkload < TESTER_BATCH_LANES) ?
+                totalWorkloads - firstWorkload : TESTER_BATCH_LANES;
+        uint32_t lane = 0;
+        for (; lane < totalLanes; ++lane)
+        {
+            laneWorkloads[lane] = &workloads[(size_t) lane * maximumProcesses];
+            totalProcesses[lane] = generateWorkload(&workloads[(size_t) lane * maximumProcesses], maximumProcesses);
+            // Counter based random numbers are keyed by process and burst, so have no offset
+            randomNumberOffsets[lane] = randomSource.isCounterBased ? 0 :
+                    (uint32_t) nextInteger(0, randomSource.totalRandomNumbers - 1);
+        }
+
+        // Every scheduler algorithm, with its parameters drawn afresh for each batch of workloads
+        uint8_t schedulerAlgorithm = 0;
+        for (; schedulerAlgorithm <= 5; ++schedulerAlgorithm)
+        {
+            struct TestConfiguration configuration = {0, schedulerAlgorithm, {0, 0, 0}, &randomSource, 0};
+            generateParameters(&configuration.parameters);
+            struct Divergence divergence;
+            for (lane = 0; lane < totalLanes; ++lane)
+            {
+                if (!checkEventDrivenEngine(laneWorkloads[lane], totalProcesses[lane], &configuration, &divergence))
+                    reportDivergence(laneWorkloads[lane], totalProcesses[lane], &configuration, &divergence);
+            }
+
+            // UNI and CFS are not run in lockstep by the batch engine, which runs each of their lanes alone instead
+            configuration.engine = 1;
+            if ((schedulerAlgorithm != 2) && (schedulerAlgorithm != 5)
+                && !checkBatchEngine(laneWorkloads, totalProcesses, totalLanes, &configuration, &divergence, &lane))
+                reportDivergence(laneWorkloads[lane], totalProcesses[lane], &configuration, &divergence);
+
+            // Every algorithm is also run end to end, which is how UNI and CFS are run by the batch engine at all
+            configuration.engine = 2;
+            if (!checkBatchRun(laneWorkloads, totalProcesses, randomNumberOffsets, totalLanes, &configuration,
+                               &divergence, &lane))
+            {
+                configuration.randomNumberOffset = randomNumberOffsets[lane];
+                reportDivergence(laneWorkloads[lane], totalProcesses[lane], &configuration, &divergence);
+            }
+        }
+    }
+
+    printf("No divergences from the reference engine in %u workloads under every scheduler algorithm (%" PRIu64
+           " cycles compared)\n", totalWorkloads, TOTAL_CYCLES_COMPARED);
+    free(workloads);
+    freeRandomNumberSource(&randomSource);
+    return EXIT_SUCCESS;
+} // End of the main function
@@ -0,0 +1,117 @@
+#include <string.h>
+#include <math.h>
+
+#include "latencyHistogram.h"
+
+/**
+ * Finds the bucket a value is counted in
+ */
+static uint32_t getBucketIndex(uint64_t value)
+{
+    if (value < (1 << LATENCY_HISTOGRAM_SUB_BUCKET_BITS))
+        return (uint32_t) value;        // Small enough to be counted exactly
+
+    // Keeps only the top SUB_BUCKET_BITS bits of the value
+    uint32_t magnitude = 63 - (uint32_t) __builtin_clzll(value);
+    uint32_t shift = magnitude - LATENCY_HISTOGRAM_SUB_BUCKET_BITS + 1;
+    uint32_t subBucket = (uint32_t) (value >> shift) - LATENCY_HISTOGRAM_HALF_SUB_BUCKET_COUNT;
+    return (shift + 1) * LATENCY_HISTOGRAM_HALF_SUB_BUCKET_COUNT + subBucket;
+} // End of the get bucket index function
+
+/**
+ * Finds the largest value that would be counted in a bucket
+ */
+static uint64_t getHighestEquivalentValue(uint32_t bucketIndex)
+{
+    if (bucketIndex < (1 << LATENCY_HISTOGRAM_SUB_BUCKET_BITS))
+        return bucketIndex;
+
+    uint32_t shift = (bucketIndex / LATENCY_HISTOGRAM_HALF_SUB_BUCKET_COUNT) - 1;
+    uint64_t topBits = (bucketIndex % LATENCY_HISTOGRAM_HALF_SUB_BUCKET_COUNT) + LATENCY_HISTOGRAM_HALF_SUB_BUCKET_COUNT;
+    return (topBits << shift) + ((((uint64_t) 1) << shift) - 1);
+} // End of the get highest equivalent value function
+
+/**
+ * Empties a histogram
+ */
+void resetLatencyHistogram(struct LatencyHistogram* histogram)
+{
+    memset(histogram->counts, 0, sizeof(histogram->counts));
+    histogram->totalCount = 0;
+    histogram->minimum = UINT64_MAX;
+    histogram->maximum = 0;
+    histogram->total = 0.0;
+} // End of the reset latency histogram function
+
+/**
+ * Counts a single latency
+ */
+void recordLatency(struct LatencyHistogram* histogram, uint64_t value)
+{
+    ++histogram->counts[getBucketIndex(value)];
+    ++histogram->totalCount;
+    if (value < histogram->minimum)
+        histogram->minimum = value;
+    if (value > histogram->maximum)
+        histogram->maximum = value;
+    histogram->total += (double) value;
+} // End of the record latency function
+
+/**
+ * Adds every count of source into destination, e.g. to combine the histograms of runs done in parallel
+ */
+void mergeLatencyHistograms(struct LatencyHistogram* destination, const struct LatencyHistogram* source)
+{
+    uint32_t i = 0;
+    for (; i < LATENCY_HISTOGRAM_BUCKET_COUNT; ++i)
+        destination->counts[i] += source->counts[i];
+    destination->totalCount += source->totalCount;
+    if (source->minimum < destination->minimum)
+        destination->minimum = source->minimum;
+    if (source->maximum > destination->maximum)
+        destination->maximum = source->maximum;
+    destination->total += source->total;
+} // End of the merge latency histograms function
+
+/**
+ * Finds the value at or below which the given percentage of recorded values fall
+ */
+uint64_t getLatencyPercentile(const struct LatencyHistogram* histogram, double percentile)
+{
+    if (histogram->totalCount == 0)
+        return 0;
+
+    // The rank of the value wanted, counting from 1
+    uint64_t targetRank = (uint64_t) ceil((percentile / 100.0) * histogram->totalCount);
+    if (targetRank < 1)
+        targetRank = 1;
+    if (targetRank > histogram->totalCount)
+        targetRank = histogram->totalCount;
+
+    uint64_t cumulativeCount = 0;
+    uint32_t i = 0;
+    for (; i < LATENCY_HISTOGRAM_BUCKET_COUNT; ++i)
+    {
+        cumulativeCount += histogram->counts[i];
+        if (cumulativeCount >= targetRank)
+        {
+            uint64_t value = getHighestEquivalentValue(i);
+            return (value > histogram->maximum) ? histogram->maximum : value;
+        }
+    }
+    return histogram->maximum;
+} // End of the get latency percentile function
+
+/**
+ * Fills in the mean, p50, p90, p99, p99.9 and maximum of a histogram
+ */
+void getLatencyPercentiles(const struct LatencyHistogram* histogram, struct LatencyPercentiles* percentiles)
+{
+    percentiles->totalCount = histogram->totalCount;
+    percentiles->mean = (histogram->totalCount == 0) ? 0.0 : histogram->total / histogram->totalCount;
+    percentiles->p50 = getLatencyPercentile(histogram, 50.0);
+    percentiles->p90 = getLatencyPercentile(histogram, 90.0);
+    percentiles->p99 = getLatencyPercentile(histogram, 99.0);
+    percentiles->p999 = getLatencyPercentile(histogram, 99.9);
+    percentiles->maximum = histogram->maximum;
+} // End of the get latency percentiles function
@@ -0,0 +1,61 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <stdint.h>
+
+/*
+ * A constant memory, log-linear (HDR style) histogram of latencies in cycles.
+ * Values below 64 are counted exactly, and above that every power of two is split into 32 linear buckets,
+ * so that any recorded value is known to within about 3%.
+ */
+#define LATENCY_HISTOGRAM_SUB_BUCKET_BITS 6
+#define LATENCY_HISTOGRAM_HALF_SUB_BUCKET_COUNT (1 << (LATENCY_HISTOGRAM_SUB_BUCKET_BITS - 1))
+#define LATENCY_HISTOGRAM_BUCKET_COUNT ((64 - LATENCY_HISTOGRAM_SUB_BUCKET_BITS + 2) * LATENCY_HISTOGRAM_HALF_SUB_BUCKET_COUNT)
+
+struct LatencyHistogram {
+    uint64_t counts[LATENCY_HISTOGRAM_BUCKET_COUNT];
+    uint64_t totalCount;                // The number of values recorded
+    uint64_t minimum;                   // The smallest value recorded (exact)
+    uint64_t maximum;                   // The largest value recorded (exact)
+    double total;                       // The sum of every value recorded, for the mean
+};
+
+/* The percentiles reported for each histogram */
+struct LatencyPercentiles {
+    uint64_t totalCount;
+    double mean;
+    uint64_t p50;
+    uint64_t p90;
+    uint64_t p99;
+    uint64_t p999;
+    uint64_t maximum;
+};
+
+/**
+ * Empties a histogram
+ */
+void resetLatencyHistogram(struct LatencyHistogram* histogram);
+
+/**
+ * Counts a single latency
+ */
+void recordLatency(struct LatencyHistogram* histogram, uint64_t value);
+
+/**
+ * Adds every count of source into destination, e.g. to combine the histograms of runs done in parallel
+ */
+void mergeLatencyHistograms(struct LatencyHistogram* destination, const struct LatencyHistogram* source);
+
+/**
+ * Finds the value at or below which the given percentage of recorded values fall
+ * @param percentile The percentage, in the range [0, 100]
+ * @return The highest value equivalent to the bucket the percentile falls into (never above the maximum), or 0 if empty
+ */
+uint64_t getLatencyPercentile(const struct LatencyHistogram* histogram, double percentile);
+
+/**
+ * Fills in the mean, p50, p90, p99, p99.9 and maximum of a histogram
+ */
+void getLatencyPercentiles(const struct LatencyHistogram* histogram, struct LatencyPercentiles* percentiles);
+
+#endif // LATENCY_HISTOGRAM_H
@@ -0,0 +1,1872 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+
+#include "libscheduler.h"
+#include "telemetry.h"
+#include "submissionQueue.h"
+#include "traceImporter.h"
+
+/************************ START OF RANDOM NUMBER FUNCTIONS *************************************/
+
+/**
+ * Reads every number from a random number file (e.g. random-numbers) into memory
+ * NOTE: Only works if the integer values in the file are less than 20 in length
+ */
+bool loadRandomNumberSource(const char* fileName, struct RandomNumberSource* randomSource)
+{
+    FILE* randomNumberFile = fopen(fileName, "r");
+    if (randomNumberFile == NULL)
+        return false;
+
+    randomSource->isCounterBased = false;
+    randomSource->seed = 0;
+
+    uint32_t capacity = 1024;
+    randomSource->randomNumbers = malloc(capacity * sizeof(uint32_t));
+    randomSource->totalRandomNumbers = 0;
+
+    char str[20];
+    while ((randomSource->randomNumbers != NULL) && (fgets(str, 20, randomNumberFile) != NULL))
+    {
+        if (randomSource->totalRandomNumbers == capacity)
+        {
+            // Out of room, doubles the capacity
+            capacity *= 2;
+            uint32_t* grownNumbers = realloc(randomSource->randomNumbers, capacity * sizeof(uint32_t));
+            if (grownNumbers == NULL)
+                free(randomSource->randomNumbers);
+            randomSource->randomNumbers = grownNumbers;
+            if (grownNumbers == NULL)
+                break;
+        }
+        randomSource->randomNumbers[randomSource->totalRandomNumbers] = (uint32_t) atoi(str);
+        ++randomSource->totalRandomNumbers;
+    }
+    fclose(randomNumberFile);
+
+    if ((randomSource->randomNumbers == NULL) || (randomSource->totalRandomNumbers == 0))
+    {
+        freeRandomNumberSource(randomSource);
+        return false;
+    }
+    return true;
+} // End of the load random number source function
+
+/**
+ * Releases the memory held by a random number source
+ */
+void freeRandomNumberSource(struct RandomNumberSource* randomSource)
+{
+    free(randomSource->randomNumbers);
+    randomSource->randomNumbers = NULL;
+    randomSource->totalRandomNumbers = 0;
+} // End of the free random number source function
+
+/**
+ * Sets up a random number source that calculates each number from a seed, instead of reading a file
+ */
+void initialiseCounterBasedRandomSource(uint64_t seed, struct RandomNumberSource* randomSource)
+{
+    randomSource->randomNumbers = NULL;
+    randomSource->totalRandomNumbers = 0;
+    randomSource->isCounterBased = true;
+    randomSource->seed = seed;
+} // End of the initialise counter based random source function
+
+/**
+ * The splitmix64 finaliser, which scrambles every bit of its input into every bit of its output
+ */
+static uint64_t mixBits(uint64_t value)
+{
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+} // End of the mix bits function
+
+/**
+ * Calculates the "random" number of a single CPU burst, independently of every other burst
+ * @return A non-negative integer below 2^31, as found in the random number file
+ */
+uint32_t counterBasedRandomNumber(uint64_t seed, uint32_t processID, uint64_t burstIndex)
+{
+    uint64_t counter = (((uint64_t) processID) << 32) | (uint32_t) burstIndex;
+    uint64_t mixedSeed = mixBits(seed);
+    // Bursts past the 2^32nd fold their upper bits into the seed, so that every earlier burst is drawn as before
+    if ((burstIndex >> 32) != 0)
+        mixedSeed = mixBits(mixedSeed ^ (burstIndex >> 32));
+    return (uint32_t) (mixBits(mixedSeed + mixBits(counter ^ 0x9e3779b97f4a7c15ULL)) >> 33);
+} // End of the counter based random number function
+
+/**
+ * Retrieves the "random" number for the next CPU burst of a process
+ * @return The raw random number, as it appears in the random number file
+ */
+static uint32_t nextRandomNumber(struct SchedulerContext* context, struct Process* process)
+{
+    uint64_t burstIndex = process->totalCPUBursts++;
+    if (context->randomSource->isCounterBased)
+        return counterBasedRandomNumber(context->randomSource->seed, process->processID, burstIndex);
+
+    if (context->randomNumberIndex >= context->randomSource->totalRandomNumbers)
+    {
+        // Ran off the end of the random number file, the run stops at the end of this cycle
+        context->failure = 1;
+        return 0;
+    }
+    // Starting from an offset, wraps around to the start of the file rather than running off the end
+    uint32_t fileIndex = (uint32_t) (((uint64_t) context->randomNumberOffset + context->randomNumberIndex++)
+                                     % context->randomSource->totalRandomNumbers);
+    return context->randomSource->randomNumbers[fileIndex];
+} // End of the next random number function
+
+/**
+ * Calculates a burst from a random non-negative integer X from the random number source
+ * @return The CPUBurst, calculated with the function: 1 + (randomNumberFromFile % UpperBound)
+ */
+static uint64_t randomOS(uint64_t upperBound, uint32_t randomNumber)
+{
+    uint64_t returnValue = 1 + (randomNumber % upperBound);
+    return returnValue;
+} // End of the randomOS function
+
+/**
+ * Draws the next CPU burst of a process, from the random number source, or from its traced bursts when replaying a trace
+ * @return The CPU burst, before being cut down to the CPU time the process has left
+ */
+static uint64_t nextCPUBurst(struct SchedulerContext* context, struct Process* process)
+{
+    if (context->burstTrace != NULL)
+    {
+        // A preempted process carries on with the rest of its traced burst, rather than drawing a new one
+        if ((process->totalCPUBursts != 0) && (process->CPUBurst > 0))
+            return process->CPUBurst;
+        const struct TracedTask* task = &context->burstTrace->tasks[process->processID];
+        return task->CPUBursts[process->totalCPUBursts++ % task->totalBursts];
+    }
+
+    uint32_t unsignedRandomInteger = nextRandomNumber(context, process);
+    // Prints out the random number, assuming the random flag is passed in
+    if (context->isRandomMode && (context->failure == 0))
+        printf("Find burst when choosing ready process to run %i\n", unsignedRandomInteger);
+    return randomOS(process->B, unsignedRandomInteger);
+} // End of the next CPU burst function
+
+/**
+ * Calculates the I/O burst that follows the CPU burst a process was last given
+ * @return The cycles the process is to be blocked for once its CPU burst runs out
+ */
+static int64_t getIOBurst(const struct SchedulerContext* context, const struct Process* process)
+{
+    if (context->burstTrace != NULL)
+    {
+        // Blocks for exactly the traced I/O burst
+        const struct TracedTask* task = &context->burstTrace->tasks[process->processID];
+        return (int64_t) task->IOBursts[(process->totalCPUBursts - 1) % task->totalBursts];
+    }
+    return (int64_t) (1 + (process->M * process->CPUBurst));
+} // End of the get IO burst function
+
+/************************ END OF RANDOM NUMBER FUNCTIONS *************************************/
+
+/************************ START OF READY QUEUE HELPER FUNCTIONS *************************************/
+
+/**
+ * Retrieves the absolute deadline of a process, with processes without a deadline coming after every other
+ */
+static uint64_t getAbsoluteDeadline(const struct Process* process)
+{
+    return (process->D == 0) ? UINT64_MAX : process->A + process->D;
+} // End of the get absolute deadline function
+
+/**
+ * Checks whether one process should run before another under EDF, breaking ties by the order they became ready
+ */
+static bool isEarlierDeadline(const struct Process* first, const struct Process* second)
+{
+    uint64_t firstDeadline = getAbsoluteDeadline(first);
+    uint64_t secondDeadline = getAbsoluteDeadline(second);
+    if (firstDeadline != secondDeadline)
+        return firstDeadline < secondDeadline;
+    return first->readySequence < second->readySequence;
+} // End of the is earlier deadline function
+
+/**
+ * Inserts a process into the EDF ready heap, sifting it up past any process with a later deadline
+ */
+static void pushReadyHeap(struct SchedulerContext* context, struct Process* newNode)
+{
+    struct Process** heap = context->readyHeap;
+    uint32_t i = context->readyProcessQueueSize++;
+    while ((i != 0) && isEarlierDeadline(newNode, heap[(i - 1) / 2]))
+    {
+        heap[i] = heap[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    heap[i] = newNode;
+} // End of the push ready heap function
+
+/**
+ * Removes the process with the earliest deadline from the EDF ready heap
+ */
+static struct Process* popReadyHeap(struct SchedulerContext* context)
+{
+    struct Process** heap = context->readyHeap;
+    struct Process* earliestProcess = heap[0];
+    struct Process* lastProcess = heap[--context->readyProcessQueueSize];
+
+    // Sifts the last process down from the root, into the gap left behind
+    uint32_t i = 0;
+    uint32_t size = context->readyProcessQueueSize;
+    while (2 * i + 1 < size)
+    {
+        uint32_t child = 2 * i + 1;
+        if ((child + 1 < size) && isEarlierDeadline(heap[child + 1], heap[child]))
+            ++child;
+        if (!isEarlierDeadline(heap[child], lastProcess))
+            break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = lastProcess;
+    return earliestProcess;
+} // End of the pop ready heap function
+
+/************************ START OF CFS RUN QUEUE HELPER FUNCTIONS *************************************/
+
+// The CFS load weight of each niceness from -20 to 19, each step being about 10% more or less CPU (as in Linux)
+static const uint32_t NICENESS_TO_WEIGHT[40] = {
+    88761, 71755, 56483, 46273, 36291, 29154, 23254, 18705, 14949, 11916,
+    9548, 7620, 6100, 4904, 3906, 3121, 2501, 1991, 1586, 1277,
+    1024, 820, 655, 526, 423, 335, 272, 215, 172, 137,
+    110, 87, 70, 56, 45, 36, 29, 23, 18, 15
+};
+#define NICENESS_0_WEIGHT 1024
+
+/**
+ * Retrieves the CFS load weight of a niceness, clamped to between -20 and 19
+ */
+static uint32_t getNicenessWeight(int32_t niceness)
+{
+    if (niceness < -20)
+        niceness = -20;
+    if (niceness > 19)
+        niceness = 19;
+    return NICENESS_TO_WEIGHT[niceness + 20];
+} // End of the get niceness weight function
+
+/**
+ * Checks whether one process should run before another under CFS, breaking ties by the order they became ready
+ */
+static bool isLowerVruntime(const struct Process* first, const struct Process* second)
+{
+    if (first->vruntime != second->vruntime)
+        return first->vruntime < second->vruntime;
+    return first->readySequence < second->readySequence;
+} // End of the is lower vruntime function
+
+static uint8_t getRunQueueHeight(const struct Process* node)
+{
+    return (node == NULL) ? 0 : node->runQueueHeight;
+} // End of the get run queue height function
+
+/**
+ * Recalculates the height of a run queue node from its children
+ */
+static void updateRunQueueHeight(struct Process* node)
+{
+    uint8_t leftHeight = getRunQueueHeight(node->runQueueLeft);
+    uint8_t rightHeight = getRunQueueHeight(node->runQueueRight);
+    node->runQueueHeight = 1 + ((leftHeight > rightHeight) ? leftHeight : rightHeight);
+} // End of the update run queue height function
+
+/**
+ * Rotates a subtree so that its left child becomes its root, returning the new root
+ */
+static struct Process* rotateRunQueueRight(struct Process* node)
+{
+    struct Process* newRoot = node->runQueueLeft;
+    node->runQueueLeft = newRoot->runQueueRight;
+    newRoot->runQueueRight = node;
+    updateRunQueueHeight(node);
+    updateRunQueueHeight(newRoot);
+    return newRoot;
+} // End of the rotate run queue right function
+
+/**
+ * Rotates a subtree so that its right child becomes its root, returning the new root
+ */
+static struct Process* rotateRunQueueLeft(struct Process* node)
+{
+    struct Process* newRoot = node->runQueueRight;
+    node->runQueueRight = newRoot->runQueueLeft;
+    newRoot->runQueueLeft = node;
+    updateRunQueueHeight(node);
+    updateRunQueueHeight(newRoot);
+    return newRoot;
+} // End of the rotate run queue left function
+
+/**
+ * Restores the AVL balance of a subtree whose children differ in height by at most 2, returning the new root
+ */
+static struct Process* rebalanceRunQueue(struct Process* node)
+{
+    updateRunQueueHeight(node);
+    int32_t balance = (int32_t) getRunQueueHeight(node->runQueueLeft) - getRunQueueHeight(node->runQueueRight);
+    if (balance > 1)
+    {
+        // Left heavy
+        if (getRunQueueHeight(node->runQueueLeft->runQueueLeft) < getRunQueueHeight(node->runQueueLeft->runQueueRight))
+            node->runQueueLeft = rotateRunQueueLeft(node->runQueueLeft);
+        return rotateRunQueueRight(node);
+    }
+    if (balance < -1)
+    {
+        // Right heavy
+        if (getRunQueueHeight(node->runQueueRight->runQueueRight) < getRunQueueHeight(node->runQueueRight->runQueueLeft))
+            node->runQueueRight = rotateRunQueueRight(node->runQueueRight);
+        return rotateRunQueueLeft(node);
+    }
+    return node;
+} // End of the rebalance run queue function
+
+/**
+ * Inserts a process into a run queue subtree in O(log n), returning the new root of the subtree
+ */
+static struct Process* insertIntoRunQueue(struct Process* root, struct Process* newNode)
+{
+    if (root == NULL)
+    {
+        newNode->runQueueLeft = NULL;
+        newNode->runQueueRight = NULL;
+        newNode->runQueueHeight = 1;
+        return newNode;
+    }
+    if (isLowerVruntime(newNode, root))
+        root->runQueueLeft = insertIntoRunQueue(root->runQueueLeft, newNode);
+    else
+        root->runQueueRight = insertIntoRunQueue(root->runQueueRight, newNode);
+    return rebalanceRunQueue(root);
+} // End of the insert into run queue function
+
+/**
+ * Removes the process with the lowest vruntime from a run queue subtree in O(log n), returning the new root
+ * @param leftmostNode Set to the removed process
+ */
+static struct Process* removeLeftmostFromRunQueue(struct Process* root, struct Process** leftmostNode)
+{
+    if (root->runQueueLeft == NULL)
+    {
+        *leftmostNode = root;
+        struct Process* rightChild = root->runQueueRight;
+        root->runQueueRight = NULL;
+        return rightChild;
+    }
+    root->runQueueLeft = removeLeftmostFromRunQueue(root->runQueueLeft, leftmostNode);
+    return rebalanceRunQueue(root);
+} // End of the remove leftmost from run queue function
+
+/**
+ * Retrieves the process with the lowest vruntime, without removing it (NULL if the run queue is empty)
+ */
+static struct Process* getLeftmostInRunQueue(const struct SchedulerContext* context)
+{
+    struct Process* node = context->runQueueRoot;
+    while ((node != NULL) && (node->runQueueLeft != NULL))
+        node = node->runQueueLeft;
+    return node;
+} // End of the get leftmost in run queue function
+
+/**
+ * Moves the minimum vruntime up to the lowest vruntime of the running and run queue processes, never back down
+ */
+static void updateMinimumVruntime(struct SchedulerContext* context)
+{
+    struct Process* leftmostNode = getLeftmostInRunQueue(context);
+    uint64_t vruntime = context->minimumVruntime;
+    if (context->currentRunningProcess != NULL)
+        vruntime = context->currentRunningProcess->vruntime;
+    if ((leftmostNode != NULL) && ((context->currentRunningProcess == NULL) || (leftmostNode->vruntime < vruntime)))
+        vruntime = leftmostNode->vruntime;
+    if (vruntime > context->minimumVruntime)
+        context->minimumVruntime = vruntime;
+} // End of the update minimum vruntime function
+
+/**
+ * Adds a process to the CFS run queue. New processes start at the minimum vruntime, and woken ones may be up to
+ * half the target latency behind it, so that sleeping does not bank an unbounded amount of CPU time.
+ */
+static void enqueueRunQueue(struct SchedulerContext* context, struct Process* newNode)
+{
+    updateMinimumVruntime(context);
+    if (newNode != context->currentRunningProcess)
+    {
+        uint64_t sleeperCredit = (uint64_t) context->parameters.targetLatency * NICENESS_0_WEIGHT / 2;
+        uint64_t minimumPlacement = context->minimumVruntime;
+        if (newNode->firstDispatchCycle != -1)
+            minimumPlacement = (minimumPlacement > sleeperCredit) ? minimumPlacement - sleeperCredit : 0;
+        if (newNode->vruntime < minimumPlacement)
+            newNode->vruntime = minimumPlacement;
+        context->isWakeupPending = true;
+    }
+
+    context->runQueueRoot = insertIntoRunQueue(context->runQueueRoot, newNode);
+    context->runQueueWeight += newNode->weight;
+    ++context->readyProcessQueueSize;
+} // End of the enqueue run queue function
+
+/**
+ * Removes the process with the lowest vruntime from the CFS run queue
+ */
+static struct Process* dequeueRunQueue(struct SchedulerContext* context)
+{
+    struct Process* leftmostNode;
+    context->runQueueRoot = removeLeftmostFromRunQueue(context->runQueueRoot, &leftmostNode);
+    context->runQueueWeight -= leftmostNode->weight;
+    --context->readyProcessQueueSize;
+    return leftmostNode;
+} // End of the dequeue run queue function
+
+/**
+ * Calculates the CFS timeslice of a process about to run: its share (by weight) of the scheduling period, which is
+ * the target latency, stretched so that every runnable process gets at least the minimum granularity
+ */
+static int64_t getTimeslice(const struct SchedulerContext* context, const struct Process* process)
+{
+    uint64_t totalWeight = context->runQueueWeight + process->weight;
+    uint64_t period = (uint64_t) (context->readyProcessQueueSize + 1) * context->parameters.minimumGranularity;
+    if (period < context->parameters.targetLatency)
+        period = context->parameters.targetLatency;
+
+    uint64_t timeslice = period * process->weight / totalWeight;
+    if (timeslice < context->parameters.minimumGranularity)
+        timeslice = context->parameters.minimumGranularity;
+    if (timeslice == 0)
+        timeslice = 1;
+    return (int64_t) timeslice;
+} // End of the get timeslice function
+
+/************************ END OF CFS RUN QUEUE HELPER FUNCTIONS *************************************/
+
+/**
+* A queue insertion function for the ready function
+*/
+static void enqueueReadyProcess(struct SchedulerContext* context, struct Process* newNode)
+{
+    if (context->schedulerAlgorithm == 4)
+    {
+        // EDF keeps its ready queue as a heap instead
+        newNode->readySequence = context->totalReadyEnqueues++;
+        pushReadyHeap(context, newNode);
+        return;
+    }
+    else if (context->schedulerAlgorithm == 5)
+    {
+        // CFS keeps its ready queue as a tree instead
+        newNode->readySequence = context->totalReadyEnqueues++;
+        enqueueRunQueue(context, newNode);
+        return;
+    }
+
+    // Identical to the insertBack() of a linked list
+    if (context->readyProcessQueueSize == 0)
+    {
+        // Queue is empty, simply point head and tail to the newNode
+        context->readyHead = newNode;
+        context->readyTail = newNode;
+    }
+    else
+    {
+        // Queue is not empty, gets the back and inserts behind the tail
+        newNode->nextInReadyQueue = NULL;
+
+        context->readyTail->nextInReadyQueue = newNode;
+        context->readyTail = context->readyTail->nextInReadyQueue; // Sets the new tail.nextInReady == NULL
+    }
+    ++context->readyProcessQueueSize;
+} // End of the ready process enqueue function
+
+/**
+ * Dequeues the process from the queue, and returns the removed node
+ */
+static struct Process* dequeueReadyProcess(struct SchedulerContext* context)
+{
+    // Identical to removeFront() of a linked list
+    if (context->readyProcessQueueSize == 0)
+    {
+        // Queue is empty, returns null
+        printf("ERROR: Attempted to dequeue from the ready process pool\n");
+        return NULL;
+    }
+    else if (context->schedulerAlgorithm == 4)
+    {
+        // EDF always dequeues the process with the earliest deadline
+        return popReadyHeap(context);
+    }
+    else if (context->schedulerAlgorithm == 5)
+    {
+        // CFS always dequeues the process with the lowest vruntime
+        return dequeueRunQueue(context);
+    }
+    else
+    {
+        // Queue is not empty, retains the old head for the return value, and sets the new head
+        struct Process* oldHead = context->readyHead;
+        context->readyHead = context->readyHead->nextInReadyQueue;
+        --context->readyProcessQueueSize;
+
+        // Queue is now empty, with both head & tail set to NULL
+        if (context->readyProcessQueueSize == 0)
+            context->readyTail = NULL;
+        oldHead->nextInReadyQueue = NULL;
+        return oldHead;
+    }
+} // End of the ready process dequeue function
+
+/************************ END OF READY QUEUE HELPER FUNCTIONS *************************************/
+
+/************************ START OF READY SUSPENDED QUEUE HELPER FUNCTIONS *************************************/
+
+/**
+* A queue insertion function for the ready suspended queue
+*/
+static void enqueueReadySuspendedProcess(struct SchedulerContext* context, struct Process* newNode)
+{
+    // Identical to the insertBack() of a linked list
+    if (context->readySuspendedProcessQueueSize == 0)
+    {
+        // Queue is empty, simply point head and tail to the newNode
+        context->readySuspendedHead = newNode;
+        context->readySuspendedTail = newNode;
+    }
+    else
+    {
+        // Queue is not empty, gets the back and inserts behind the tail
+        newNode->nextInReadySuspendedQueue = NULL;
+
+        context->readySuspendedTail->nextInReadySuspendedQueue = newNode;
+        context->readySuspendedTail = context->readySuspendedTail->nextInReadySuspendedQueue; // Sets the new tail.nextInreadySuspended == NULL
+    }
+    ++context->readySuspendedProcessQueueSize;
+} // End of the readySuspended process enqueue function
+
+/**
+ * Dequeues the process from the queue, and returns the removed node
+ */
+static struct Process* dequeueReadySuspendedProcess(struct SchedulerContext* context)
+{
+    // Identical to removeFront() of a linked list
+    if (context->readySuspendedProcessQueueSize == 0)
+    {
+        // Queue is empty, returns null
+        printf("ERROR: Attempted to dequeue from the readySuspended process pool\n");
+        return NULL;
+    }
+    else
+    {
+        // Queue is not empty, retains the old head for the return value, and sets the new head
+        struct Process* oldHead = context->readySuspendedHead;
+        context->readySuspendedHead = context->readySuspendedHead->nextInReadySuspendedQueue;
+        --context->readySuspendedProcessQueueSize;
+
+        // Checks if queue is now empty, with both head & tail set to NULL
+        if (context->readySuspendedProcessQueueSize == 0)
+            context->readySuspendedTail = NULL;
+
+        oldHead->nextInReadySuspendedQueue = NULL;
+        return oldHead;
+    }
+} // End of the readySuspended process dequeue function
+
+/************************ END OF READY SUSPENDED QUEUE HELPER FUNCTIONS *************************************/
+
+/************************ START OF BLOCKED LIST HELPER FUNCTIONS *************************************/
+
+/**
+* A queue insertion function for the blocked list
+*/
+static void addToBlockedList(struct SchedulerContext* context, struct Process* newNode)
+{
+    // Identical to the insertBack() of a linked list
+    if ((context->blockedHead == NULL) || (context->blockedTail == NULL))
+    {
+        // Queue is empty, simply point head and tail to the newNode
+        context->blockedHead = newNode;
+        context->blockedTail = newNode;
+    }
+    else
+    {
+        // Queue is not empty, gets the back and inserts behind the tail
+        context->blockedTail->nextInBlockedList = newNode;
+        context->blockedTail = newNode;
+    }
+    ++context->blockedProcessListSize;
+} // End of the blocked process enqueue function
+
+/**
+ * Dequeues the process from the queue, and returns the removed node
+ */
+static struct Process* dequeueBlockedProcess(struct SchedulerContext* context)
+{
+    // Identical to removeFront() of a linked list
+    if (context->blockedHead == NULL)
+    {
+        printf("ERROR: Attempted to dequeue from the blocked process pool\n");
+        // Queue is empty, returns null
+        return NULL;
+    }
+    else
+    {
+        // Queue is not empty, retains the old head for the return value, and sets the new head
+        struct Process* oldHead = context->blockedHead;
+        context->blockedHead = context->blockedHead->nextInBlockedList;
+        if (context->blockedHead == NULL)
+            context->blockedTail = NULL;
+        --context->blockedProcessListSize;
+        oldHead->nextInBlockedList = NULL;
+        return oldHead;
+    }
+} // End of the blocked process dequeue function
+
+/************************ END OF BLOCKED LIST HELPER FUNCTIONS *************************************/
+
+/************************ START OF RUNNING PROGRAM FUNCTIONS *************************************/
+
+/**
+ * Processes any job in the blockedProcessesList
+ */
+static void doBlockedProcesses(struct SchedulerContext* context)
+{
+    if (context->blockedProcessListSize != 0)
+    {
+        // Blocked list is not empty, goes through each one to check if they need to be moved to ready or not
+        struct Process* currentNode = context->blockedHead;
+        while (currentNode != NULL)
+        {
+            // Iterates through the blocked process list
+            if (currentNode->IOBurst <= 0)
+            {
+                // IOBurst time is 0, moves to ready
+                currentNode->status = 1;
+                currentNode->readySinceCycle = context->currentCycle;
+
+                // Removes this process from the blocked list to the ready queue
+                if (currentNode->processID == context->blockedHead->processID)
+                {
+                    // Removes from the front, simply dequeues
+                    struct Process* unBlockedProcess = dequeueBlockedProcess(context);
+                    enqueueReadyProcess(context, unBlockedProcess);
+                }
+                else if (currentNode->processID == context->blockedTail->processID)
+                {
+                    // Removes from the back
+                    struct Process* currentBlockedIterationProcess = context->blockedHead;
+                    while (currentBlockedIterationProcess->nextInBlockedList->nextInBlockedList != NULL)
+                    {currentBlockedIterationProcess = currentBlockedIterationProcess->nextInBlockedList;}
+
+                    context->blockedTail = currentBlockedIterationProcess;
+
+                    struct Process* nodeToBeAddedToReady = currentBlockedIterationProcess->nextInBlockedList;
+                    currentBlockedIterationProcess->nextInBlockedList = NULL;
+                    nodeToBeAddedToReady->nextInBlockedList = NULL;
+                    --context->blockedProcessListSize;
+
+                    enqueueReadyProcess(context, nodeToBeAddedToReady);
+                }
+                else
+                {
+                    // Removes from the middle
+                    struct Process* currentBlockedIterationProcess = context->blockedHead;
+
+                    // Iterates until right before the middle block
+                    while (currentBlockedIterationProcess->nextInBlockedList->processID != currentNode->processID)
+                    {currentBlockedIterationProcess = currentBlockedIterationProcess->nextInBlockedList;}
+
+                    struct Process* nodeToBeAddedToReady = currentBlockedIterationProcess->nextInBlockedList;
+
+                    currentBlockedIterationProcess->nextInBlockedList =
+                            currentBlockedIterationProcess->nextInBlockedList->nextInBlockedList;
+                    nodeToBeAddedToReady->nextInBlockedList = NULL;
+                    --context->blockedProcessListSize;
+                    enqueueReadyProcess(context, nodeToBeAddedToReady);
+                }
+            } // End of dealing with removing any processes that need to be moved to ready
+            currentNode = currentNode->nextInBlockedList;
+        } // End of iterating through the blocked queue
+    } // End of dealing with all blocked processes in the blocked list
+} // End of the doBlockedProcess function
+
+/**
+ * Processes any job that is currently running
+ * @param context The simulation, whose schedulerAlgorithm is one of 0 = FCFS, 1 = RR, 2 = UNI, 3 = SJF, 4 = EDF,
+ * 5 = CFS.
+ */
+static void doRunningProcesses(struct SchedulerContext* context)
+{
+    if (context->currentRunningProcess != NULL)
+    {
+        // A process is currently running
+
+        // Calculates the IOburst the first time around
+        if (context->currentRunningProcess->isFirstTimeRunning == true)
+        {
+            context->currentRunningProcess->isFirstTimeRunning = false;
+            context->currentRunningProcess->IOBurst = getIOBurst(context, context->currentRunningProcess);
+        }
+
+        if (context->currentRunningProcess->C == context->currentRunningProcess->currentCPUTimeRun)
+        {
+            // Process has completed running, moves to finished process container
+            context->currentRunningProcess->status = 4;
+            context->currentRunningProcess->finishingTime = context->currentCycle;
+            recordLatency(&context->turnaroundHistogram,
+                          context->currentRunningProcess->finishingTime - context->currentRunningProcess->A);
+            recordLatency(&context->waitingHistogram, context->currentRunningProcess->currentWaitingTime);
+            if (context->currentRunningProcess->D != 0)
+            {
+                uint64_t deadline = getAbsoluteDeadline(context->currentRunningProcess);
+                uint64_t finishingTime = context->currentRunningProcess->finishingTime;
+                recordLatency(&context->latenessHistogram, (finishingTime > deadline) ? finishingTime - deadline : 0);
+            }
+            context->finishedProcessOrder[context->totalFinishedProcesses] = context->currentRunningProcess->processID;
+            ++context->totalFinishedProcesses;
+            if (context->schedulerAlgorithm == 2)
+                context->uniprogrammedProcess = NULL;
+            context->currentRunningProcess = NULL;
+        }
+        else if (context->currentRunningProcess->CPUBurst <= 0)
+        {
+            // Process has run out of CPU burst, moves to blocked
+            context->currentRunningProcess->status = 3;
+            addToBlockedList(context, context->currentRunningProcess);
+            context->currentRunningProcess = NULL;
+        } // End of dealing with the running process that has run out of CPU Burst, moved to blocked list
+        else if (((context->schedulerAlgorithm == 1) || (context->schedulerAlgorithm == 5))
+                 && (context->currentRunningProcess->quantum <= 0))
+        {
+            // Process has been preempted, moves to ready
+            context->currentRunningProcess->status = 1;
+            context->currentRunningProcess->readySinceCycle = context->currentCycle;
+            enqueueReadyProcess(context, context->currentRunningProcess);
+            context->currentRunningProcess = NULL;
+        } // End of dealing with the running process being pre-empted back to the ready queue
+        else
+        {
+            // Process still has CPU burst, stays in running
+            context->currentRunningProcess->status = 2;
+        }// End of dealing with the running process remaining in the running pool
+    } // End of dealing with the running queue when a process is running
+} // End of the do running process function
+
+/**
+ * Starts any process that begins at their designated start time (their A value)
+ * @param context The simulation, whose processContainer holds the original processes inputted
+ */
+static void createProcesses(struct SchedulerContext* context)
+{
+    uint32_t i = 0;
+    for (; i < context->totalCreatedProcesses; ++i)
+    {
+        if (context->processContainer[i].A == context->currentCycle)
+        {
+            // Time for this process to be created, and enqueued to the ready queue
+            ++context->totalStartedProcesses;
+            context->processContainer[i].status = 1; // Sets the status to ready
+            context->processContainer[i].readySinceCycle = context->currentCycle;
+            if ((context->uniprogrammedProcess == NULL) && (context->isFirstTimeRunningUniprogrammed == true))
+            {
+                context->isFirstTimeRunningUniprogrammed = false;
+                context->uniprogrammedProcess = &context->processContainer[i];
+            }
+            enqueueReadyProcess(context, &context->processContainer[i]);
+        }
+    }
+} // End of the createProcess function
+
+/**
+ * Records the response time (on the first dispatch) and ready queue delay of a process that is about to run
+ */
+static void recordDispatch(struct SchedulerContext* context, struct Process* dispatchedProcess)
+{
+    if (dispatchedProcess->firstDispatchCycle == -1)
+    {
+        dispatchedProcess->firstDispatchCycle = context->currentCycle;
+        recordLatency(&context->responseHistogram, context->currentCycle - dispatchedProcess->A);
+    }
+    recordLatency(&context->readyDelayHistogram, context->currentCycle - dispatchedProcess->readySinceCycle);
+} // End of the record dispatch function
+
+/**
+ * Processes any job in the readyQueue or readySuspendedQueue
+ * @param context The simulation, whose schedulerAlgorithm is one of 0 = FCFS, 1 = RR, 2 = UNI, 3 = SJF, 4 = EDF,
+ * 5 = CFS.
+ */
+static void doReadyProcesses(struct SchedulerContext* context)
+{
+    // Suspends anything that isn't the UNIPROGRAMMED process
+    if ((context->uniprogrammedProcess != NULL) && (context->readyProcessQueueSize != 0)
+        && (context->readyHead != context->uniprogrammedProcess) && (context->schedulerAlgorithm == 2))
+    {
+        // There is a process running, so suspends anything to the ready suspended queue
+        uint32_t i = 0;
+        for (; i < context->readyProcessQueueSize; ++i)
+        {
+            struct Process* suspendedNode = dequeueReadyProcess(context);
+            suspendedNode->status = 1;
+            enqueueReadySuspendedProcess(context, suspendedNode);
+        }
+    }
+
+    // Deals with the ready suspended queue
+    if ((context->readySuspendedProcessQueueSize != 0) && (context->schedulerAlgorithm == 2))
+    {
+        // With nothing running, ready or blocked, the uniprogrammed process itself must have been suspended,
+        // and nothing else could ever resume a process, so resumes one anyway
+        bool isStalled = (context->currentRunningProcess == NULL) && (context->readyProcessQueueSize == 0)
+                         && (context->blockedProcessListSize == 0);
+        if ((context->uniprogrammedProcess == NULL) || isStalled) {
+            // There is no process running, dequeues a single process and readies it
+            struct Process *resumedProcess = dequeueReadySuspendedProcess(context);
+            resumedProcess->status = 1;
+            context->uniprogrammedProcess = resumedProcess;
+            enqueueReadyProcess(context, resumedProcess);
+        }
+    }// End of dealing with the ready suspended queue
+
+    // [EDF] Preempts the running process if a process with an earlier deadline has become ready
+    if ((context->schedulerAlgorithm == 4) && (context->currentRunningProcess != NULL)
+        && (context->readyProcessQueueSize != 0)
+        && (getAbsoluteDeadline(context->readyHeap[0]) < getAbsoluteDeadline(context->currentRunningProcess)))
+    {
+        context->currentRunningProcess->status = 1;
+        context->currentRunningProcess->readySinceCycle = context->currentCycle;
+        enqueueReadyProcess(context, context->currentRunningProcess);
+        context->currentRunningProcess = NULL;
+    }
+
+    // [CFS] Preempts the running process if a process that just became ready is far enough behind it in vruntime
+    if ((context->schedulerAlgorithm == 5) && context->isWakeupPending)
+    {
+        context->isWakeupPending = false;
+        struct Process* leftmostNode = getLeftmostInRunQueue(context);
+        uint64_t wakeupGranularity = (uint64_t) context->parameters.minimumGranularity * NICENESS_0_WEIGHT;
+        if ((context->currentRunningProcess != NULL) && (leftmostNode != NULL)
+            && (leftmostNode->vruntime + wakeupGranularity < context->currentRunningProcess->vruntime))
+        {
+            context->currentRunningProcess->status = 1;
+            context->currentRunningProcess->readySinceCycle = context->currentCycle;
+            enqueueReadyProcess(context, context->currentRunningProcess);
+            context->currentRunningProcess = NULL;
+        }
+    }
+
+    // Deals with the ready queue second
+    if (context->readyProcessQueueSize != 0)
+    {
+        if (context->currentRunningProcess == NULL)
+        {
+            // No process is running, is able to pick a process to run
+            if (context->schedulerAlgorithm == 3)
+            {
+                // Scheduler is shortest job first, meaning in lowest remaining CPU time required
+                uint32_t i = 0;
+                struct Process* currentReadyProcess = context->readyHead;
+                struct Process* shortestJobProcess = context->readyHead;
+                for (; i < context->readyProcessQueueSize; ++i)
+                {
+                    if ((shortestJobProcess->C - shortestJobProcess->currentCPUTimeRun) >
+                            (currentReadyProcess->C - currentReadyProcess->currentCPUTimeRun))
+                    {
+                        // Old shortest job is greater than the new one, sets the shortest job to point to the new one
+                        shortestJobProcess = currentReadyProcess;
+                    }
+                    currentReadyProcess = currentReadyProcess->nextInReadyQueue;
+                }// End of iterating through to find the shortest time remaining
+
+                // Needs to deal with removing the shortest job from the ready list (from front, back, and middle)
+                struct Process* readiedProcess;
+
+                if (context->readyHead->processID == shortestJobProcess->processID)
+                {
+                    // Dequeueing from the head of ready (normal dequeue)
+                    readiedProcess = dequeueReadyProcess(context);
+                }
+                else if (context->readyTail->processID == shortestJobProcess->processID)
+                {
+                    // Dequeues from the tail of ready list
+                    struct Process* currentReadyIterationProcess = context->readyHead;
+                    while (currentReadyIterationProcess->nextInReadyQueue->nextInReadyQueue != NULL)
+                    {currentReadyIterationProcess = currentReadyIterationProcess->nextInReadyQueue;}
+
+                    context->readyTail = currentReadyIterationProcess;
+
+                    readiedProcess = currentReadyIterationProcess->nextInReadyQueue;
+                    currentReadyIterationProcess->nextInReadyQueue = NULL;
+                    readiedProcess->nextInReadyQueue = NULL;
+                    --context->readyProcessQueueSize;
+                }
+                else
+                {
+                    // Dequeues from the middle of ready list
+                    struct Process* currentReadyIterationProcess = context->readyHead;
+
+                    // Iterates until right before the middle block
+                    while (currentReadyIterationProcess->nextInReadyQueue->processID != shortestJobProcess->processID)
+                    {currentReadyIterationProcess = currentReadyIterationProcess->nextInReadyQueue;}
+
+                    readiedProcess = currentReadyIterationProcess->nextInReadyQueue;
+
+                    currentReadyIterationProcess->nextInReadyQueue =
+                            currentReadyIterationProcess->nextInReadyQueue->nextInReadyQueue;
+                    readiedProcess->nextInReadyQueue = NULL;
+                    --context->readyProcessQueueSize;
+                }
+
+                // At this point, we have the shortest job process that should be sent, so sets it running
+                readiedProcess->status = 2;
+                readiedProcess->isFirstTimeRunning = true;
+
+                uint64_t newCPUBurst = nextCPUBurst(context, readiedProcess);
+                // Checks if the new CPU Burst time is greater than the time remaining
+                if (newCPUBurst > (readiedProcess->C - readiedProcess->currentCPUTimeRun))
+                    newCPUBurst = readiedProcess->C - readiedProcess->currentCPUTimeRun;
+                readiedProcess->CPUBurst = newCPUBurst;
+                recordDispatch(context, readiedProcess);
+                context->currentRunningProcess = readiedProcess;
+            } // End of dealing with shortest job first
+            else
+            {
+                // Is running one of the other schedulers (EDF dequeues the earliest deadline, and CFS the lowest vruntime),
+                // with no process currently running
+                struct Process* readiedNode = dequeueReadyProcess(context);
+
+                // Calculates CPU Burst stuff
+                uint64_t newCPUBurst = nextCPUBurst(context, readiedNode);
+                // Checks if the new CPU Burst time is greater than the time remaining
+                if (newCPUBurst > (readiedNode->C - readiedNode->currentCPUTimeRun))
+                    newCPUBurst = readiedNode->C - readiedNode->currentCPUTimeRun;
+                readiedNode->CPUBurst = newCPUBurst;
+
+                // Runs the process if the CPU burst is positive
+                if (readiedNode->CPUBurst > 0)
+                {
+                    // There are no running processes, and the CPU Burst is positive, so sets the process to run
+                    readiedNode->status = 2;
+                    readiedNode->isFirstTimeRunning = true;
+
+                    if (context->schedulerAlgorithm == 1)
+                    {
+                        // Scheduler is round robin, sets the quantum
+                        readiedNode->quantum = context->parameters.roundRobinQuantum;
+                    }
+                    else if (context->schedulerAlgorithm == 5)
+                    {
+                        // Scheduler is CFS, sets the quantum to the process's timeslice
+                        readiedNode->quantum = getTimeslice(context, readiedNode);
+                    }
+                    recordDispatch(context, readiedNode);
+                    context->currentRunningProcess = readiedNode;
+                }
+            } // End of running FCFS, RR, Uniprogrammed, EDF or CFS scheduler process readying sequence
+        } // End of dealing if there is no process running
+    }// End of dealing with the ready queue
+
+    // For uniprogrammed only
+    if ((context->schedulerAlgorithm == 2) && (context->readyProcessQueueSize != 0))
+    {
+        // Things are still in the ready queue
+        uint32_t i = 0;
+        for (; i < context->readyProcessQueueSize; ++i)
+        {
+            if (context->currentRunningProcess != NULL)
+            {
+                // [UNIPROGRAMMED] There are running processes, suspends the ready process to the ready suspended pool
+                struct Process* suspendedNode = dequeueReadyProcess(context);
+                suspendedNode->status = 1;
+                enqueueReadySuspendedProcess(context, suspendedNode);
+            }
+        }
+    } // End of suspending to ready suspended any remaining processes [UNIPROGRAMMED]
+} // End of the doReadyProcess function
+
+/**
+ * Alters all timers for any processes requiring a timer change
+ * @param context The simulation, whose schedulerAlgorithm is one of 0 = FCFS, 1 = RR, 2 = UNI, 3 = SJF, 4 = EDF,
+ * 5 = CFS.
+ */
+static void incrementTimers(struct SchedulerContext* context)
+{
+    // Iterates through all processes, and alters any timers that need changing (decrementing CPUBurst if running, etc)
+    uint32_t i = 0;
+    for (; i < context->totalCreatedProcesses; ++i)
+    {
+        switch (context->processContainer[i].status)
+        {
+            case 0:
+                // Node has not started
+                break;
+            case 3:
+                // Node is I/O blocked (I/O time)
+                ++context->processContainer[i].currentIOBlockedTime;
+                --context->processContainer[i].IOBurst;
+                break;
+            case 2:
+                // Node is running (CPU time)
+                ++context->processContainer[i].currentCPUTimeRun;
+                --context->processContainer[i].CPUBurst;
+                if (context->schedulerAlgorithm == 1)
+                {
+                    // Process is utilising RR, and is running, so decrements quantum
+                    --context->processContainer[i].quantum;
+                }
+                else if (context->schedulerAlgorithm == 5)
+                {
+                    // Process is utilising CFS, and is running, so decrements quantum and charges its vruntime
+                    --context->processContainer[i].quantum;
+                    context->processContainer[i].vruntime +=
+                            (uint64_t) NICENESS_0_WEIGHT * NICENESS_0_WEIGHT / context->processContainer[i].weight;
+                }
+                break;
+            case 1:
+                // Node is ready, or in ready suspended (waiting)
+                ++context->processContainer[i].currentWaitingTime;
+                break;
+            case 4:
+                // Node is terminated
+                break;
+            default:
+                // Invalid node status, the run stops at the end of this cycle
+                context->failure = 2;
+                break;
+        } // End of the per process status print statement
+    }
+
+    // Checks if a process has been blocked this cycle, used in calculating the overall time blocked
+    for (i = 0; i < context->totalCreatedProcesses; ++i)
+    {
+        if (context->processContainer[i].status == 3)
+        {
+            // At least 1 process is blocked, increments the total count
+            ++context->totalNumberOfCyclesSpentBlocked;
+            break;
+        }
+    }
+} // End of the increment timers function
+
+/**
+ * Checks off each deadline that has passed, until the first one missed (a process still unfinished after it)
+ */
+static void findFirstDeadlineMiss(struct SchedulerContext* context)
+{
+    while (context->nextDeadlineIndex < context->totalDeadlineProcesses)
+    {
+        struct Process* process = context->deadlineOrder[context->nextDeadlineIndex];
+        if (getAbsoluteDeadline(process) >= context->currentCycle)
+            break;
+        if (process->status != 4)
+        {
+            // Still unfinished, so it will finish after its deadline
+            context->firstMissCycle = context->currentCycle;
+            uint32_t i = 0;
+            for (; i < context->totalCreatedProcesses; ++i)
+                context->CPUTimeBeforeFirstMiss += context->processContainer[i].currentCPUTimeRun;
+            break;
+        }
+        ++context->nextDeadlineIndex;
+    }
+} // End of the find first deadline miss function
+
+/************************ END OF RUNNING PROGRAM FUNCTIONS *************************************/
+
+
+/************************ START OF CONTEXT FUNCTIONS *************************************/
+
+// The processes allocated for when reading a mix, doubled whenever more are read
+#define INITIAL_WORKLOAD_CAPACITY 4096
+
+/**
+ * Reads a little endian 32 bit unsigned integer, as used in the binary mix format
+ * @return false at the end of the file
+ */
+static bool readLittleEndian32(FILE* inputFile, uint32_t* value)
+{
+    unsigned char bytes[4];
+    if (fread(bytes, 1, 4, inputFile) != 4)
+        return false;
+    *value = (uint32_t) bytes[0] | ((uint32_t) bytes[1] << 8) | ((uint32_t) bytes[2] << 16) | ((uint32_t) bytes[3] << 24);
+    return true;
+} // End of the read little endian 32 function
+
+/**
+ * Reads a little endian 64 bit unsigned integer, as used in version 2 of the binary mix format
+ * @return false at the end of the file
+ */
+static bool readLittleEndian64(FILE* inputFile, uint64_t* value)
+{
+    uint32_t lowerHalf, upperHalf;
+    if (!readLittleEndian32(inputFile, &lowerHalf) || !readLittleEndian32(inputFile, &upperHalf))
+        return false;
+    *value = (uint64_t) lowerHalf | ((uint64_t) upperHalf << 32);
+    return true;
+} // End of the read little endian 64 function
+
+/**
+ * Makes room for one more process in a mix being read, growing the array as it fills, so that memory is only taken
+ * for processes actually read rather than for whatever count the mix claims to hold
+ * @param processes The processes read so far (NULL before the first)
+ * @param capacity The number of processes the array has room for, updated as it grows
+ * @param totalProcesses The number of processes read so far
+ * @return false if out of memory
+ */
+static bool reserveWorkloadEntry(struct ProcessSpecification** processes, size_t* capacity, size_t totalProcesses)
+{
+    if (totalProcesses < *capacity)
+        return true;
+
+    size_t newCapacity = (*capacity == 0) ? INITIAL_WORKLOAD_CAPACITY : *capacity * 2;
+    if ((newCapacity < *capacity) || (newCapacity > SIZE_MAX / sizeof(struct ProcessSpecification)))
+        return false;
+    struct ProcessSpecification* grownProcesses = realloc(*processes, newCapacity * sizeof(struct ProcessSpecification));
+    if (grownProcesses == NULL)
+        return false;
+    *processes = grownProcesses;
+    *capacity = newCapacity;
+    return true;
+} // End of the reserve workload entry function
+
+/**
+ * Reads a single process of a mix in version 2 of the binary format
+ * @return false at the end of the file
+ */
+static bool readBinaryProcess(FILE* inputFile, struct ProcessSpecification* process)
+{
+    uint32_t niceness;
+    if (!readLittleEndian64(inputFile, &process->A) || !readLittleEndian64(inputFile, &process->B)
+        || !readLittleEndian64(inputFile, &process->C) || !readLittleEndian64(inputFile, &process->M)
+        || !readLittleEndian64(inputFile, &process->D) || !readLittleEndian32(inputFile, &niceness))
+        return false;
+    process->niceness = (niceness > INT32_MAX) ? -(int32_t) (UINT32_MAX - niceness) - 1 : (int32_t) niceness;
+    return true;
+} // End of the read binary process function
+
+/**
+ * Reads a single process of a mix in the first binary format, which is 32 bit, widened here to the 64 bit time base
+ * @return false at the end of the file
+ */
+static bool readFirstBinaryProcess(FILE* inputFile, struct ProcessSpecification* process)
+{
+    uint32_t A, B, C, M;
+    if (!readLittleEndian32(inputFile, &A) || !readLittleEndian32(inputFile, &B)
+        || !readLittleEndian32(inputFile, &C) || !readLittleEndian32(inputFile, &M))
+        return false;
+    process->A = A;
+    process->B = B;
+    process->C = C;
+    process->M = M;
+    process->D = 0;
+    process->niceness = 0;
+    return true;
+} // End of the read first binary process function
+
+/**
+ * Reads the rest of a mix in a binary format, after its magic number (and version)
+ * @param version The version of the binary format, 1 for the first ("ABCM") format
+ */
+static bool readBinaryWorkload(FILE* inputFile, uint32_t version, struct ProcessSpecification** workload,
+                               uint32_t* totalProcesses)
+{
+    uint32_t totalNumberOfProcessesToCreate;
+    if (!readLittleEndian32(inputFile, &totalNumberOfProcessesToCreate)
+        || (totalNumberOfProcessesToCreate > MAXIMUM_WORKLOAD_PROCESSES))
+        return false;
+
+    // Always allocates, so that an empty mix is not NULL
+    struct ProcessSpecification* processes = NULL;
+    size_t capacity = 0;
+    if (!reserveWorkloadEntry(&processes, &capacity, 0))
+        return false;
+
+    uint32_t i = 0;
+    for (; i < totalNumberOfProcessesToCreate; ++i)
+    {
+        if (!reserveWorkloadEntry(&processes, &capacity, i)
+            || !((version == 1) ? readFirstBinaryProcess(inputFile, &processes[i])
+                                : readBinaryProcess(inputFile, &processes[i])))
+        {
+            free(processes);
+            return false;
+        }
+    }
+
+    *workload = processes;
+    *totalProcesses = totalNumberOfProcessesToCreate;
+    return true;
+} // End of the read binary workload function
+
+/**
+ * Reads the next value of a text mix, as plain digits, as a sign would let "-5" wrap around to 2^64 - 5
+ * @return 1 if a value was read, 0 if the next character is not a digit (such as a closing bracket), or -1 if the value
+ * is negative or too large for 64 bits
+ */
+static int32_t readWorkloadValue(FILE* inputFile, uint64_t* value)
+{
+    char digits[22];
+    if (fscanf(inputFile, " %21[0-9]", digits) != 1)
+    {
+        int32_t nextCharacter = fgetc(inputFile);
+        ungetc(nextCharacter, inputFile);
+        return (nextCharacter == '-') ? -1 : 0;
+    }
+    errno = 0;
+    *value = strtoull(digits, NULL, 10);
+    return ((strlen(digits) > 20) || (errno == ERANGE)) ? -1 : 1;
+} // End of the read workload value function
+
+/**
+ * Reads a mix in the ABCM format, e.g. "2 (0 1 5 1) (0 1 5 1)", or in either binary format (see BINARY_WORKLOAD_MAGIC
+ * and VERSIONED_BINARY_WORKLOAD_MAGIC)
+ */
+bool readWorkload(FILE* inputFile, struct ProcessSpecification** workload, uint32_t* totalProcesses)
+{
+    // Checks for the binary formats, whose magic numbers (which share their first character) cannot start a text mix
+    int32_t firstCharacter = fgetc(inputFile);
+    if (firstCharacter == BINARY_WORKLOAD_MAGIC[0])
+    {
+        char magic[sizeof(BINARY_WORKLOAD_MAGIC) - 1];
+        if (fread(magic, 1, sizeof(magic) - 1, inputFile) != sizeof(magic) - 1)
+            return false;
+        if (memcmp(magic, BINARY_WORKLOAD_MAGIC + 1, sizeof(magic) - 1) == 0)
+            return readBinaryWorkload(inputFile, 1, workload, totalProcesses);
+
+        // A later format, of which only the versions up to this one are understood
+        uint32_t version;
+        if ((memcmp(magic, VERSIONED_BINARY_WORKLOAD_MAGIC + 1, sizeof(magic) - 1) != 0)
+            || !readLittleEndian32(inputFile, &version) || (version < 2) || (version > BINARY_WORKLOAD_VERSION))
+            return false;
+        return readBinaryWorkload(inputFile, version, workload, totalProcesses);
+    }
+    ungetc(firstCharacter, inputFile);
+
+    // The count is given as the first number in the mix
+    uint64_t totalCount;
+    if ((readWorkloadValue(inputFile, &totalCount) != 1) || (totalCount > MAXIMUM_WORKLOAD_PROCESSES))
+        return false;
+    uint32_t totalNumberOfProcessesToCreate = (uint32_t) totalCount;
+
+    // Always allocates, so that an empty mix is not NULL
+    struct ProcessSpecification* processes = NULL;
+    size_t capacity = 0;
+    if (!reserveWorkloadEntry(&processes, &capacity, 0))
+        return false;
+
+    // Reads through the input, and creates all processes given, saving into an array
+    uint32_t currentNumberOfMixesCreated = 0;
+    for (; currentNumberOfMixesCreated < totalNumberOfProcessesToCreate; ++currentNumberOfMixesCreated)
+    {
+        if (!reserveWorkloadEntry(&processes, &capacity, currentNumberOfMixesCreated))
+        {
+            free(processes);
+            return false;
+        }
+        struct ProcessSpecification* currentInput = &processes[currentNumberOfMixesCreated];
+
+        // Skips the opening bracket, then reads A, B, C and M, then the optional deadline and niceness
+        fscanf(inputFile, " %*c");
+        int32_t hasDeadline = 0;
+        if ((readWorkloadValue(inputFile, &currentInput->A) != 1) || (readWorkloadValue(inputFile, &currentInput->B) != 1)
+            || (readWorkloadValue(inputFile, &currentInput->C) != 1) || (readWorkloadValue(inputFile, &currentInput->M) != 1)
+            || ((hasDeadline = readWorkloadValue(inputFile, &currentInput->D)) < 0))
+        {
+            free(processes);
+            return false;
+        }
+        currentInput->niceness = 0;
+        if (hasDeadline == 0)
+            currentInput->D = 0;
+        else if (fscanf(inputFile, " %i", &currentInput->niceness) != 1)
+            currentInput->niceness = 0;
+
+        // Then the closing bracket
+        fscanf(inputFile, " %*c");
+    }
+
+    *workload = processes;
+    *totalProcesses = totalNumberOfProcessesToCreate;
+    return true;
+} // End of the read workload function
+
+/**
+ * Orders processes by absolute deadline, then by process ID, for qsort()
+ */
+static int compareDeadlines(const void* first, const void* second)
+{
+    const struct Process* firstProcess = *(const struct Process* const*) first;
+    const struct Process* secondProcess = *(const struct Process* const*) second;
+    uint64_t firstDeadline = getAbsoluteDeadline(firstProcess);
+    uint64_t secondDeadline = getAbsoluteDeadline(secondProcess);
+    if (firstDeadline != secondDeadline)
+        return (firstDeadline < secondDeadline) ? -1 : 1;
+    return (firstProcess->processID < secondProcess->processID) ? -1 : 1;
+} // End of the compare deadlines function
+
+/**
+ * Resets the state of a single process to before it arrived, apart from its bursts
+ */
+static void resetProcess(struct Process* process)
+{
+    process->status = 0;
+    process->nextInReadyQueue = NULL;
+    process->nextInReadySuspendedQueue = NULL;
+    process->nextInBlockedList = NULL;
+
+    process->finishingTime = UINT64_MAX;
+    process->firstDispatchCycle = -1;
+    process->readySinceCycle = 0;
+    process->vruntime = 0;
+    process->runQueueLeft = NULL;
+    process->runQueueRight = NULL;
+
+    process->currentCPUTimeRun = 0;
+    process->currentIOBlockedTime = 0;
+    process->currentWaitingTime = 0;
+
+    process->isFirstTimeRunning = false;
+    process->totalCPUBursts = 0;
+} // End of the reset process function
+
+/**
+ * Allocates a context with room for a number of processes, without any processes yet
+ */
+static struct SchedulerContext* allocateSchedulerContext(uint32_t processCapacity,
+                                                         const struct RandomNumberSource* randomSource,
+                                                         uint8_t schedulerAlgorithm)
+{
+    struct SchedulerContext* context = calloc(1, sizeof(struct SchedulerContext));
+    if (context == NULL)
+        return NULL;
+
+    // Allocates one extra slot, so that an empty mix does not request zero bytes
+    context->processContainer = calloc((size_t) processCapacity + 1, sizeof(struct Process));
+    context->finishedProcessOrder = calloc((size_t) processCapacity + 1, sizeof(uint32_t));
+    context->deadlineOrder = calloc((size_t) processCapacity + 1, sizeof(struct Process*));
+    if (schedulerAlgorithm == 4)
+        context->readyHeap = calloc((size_t) processCapacity + 1, sizeof(struct Process*));
+    if ((context->processContainer == NULL) || (context->finishedProcessOrder == NULL)
+        || (context->deadlineOrder == NULL) || ((schedulerAlgorithm == 4) && (context->readyHeap == NULL)))
+    {
+        destroySchedulerContext(context);
+        return NULL;
+    }
+
+    context->processCapacity = processCapacity;
+    context->schedulerAlgorithm = schedulerAlgorithm;
+    context->randomSource = randomSource;
+    context->parameters.roundRobinQuantum = DEFAULT_ROUND_ROBIN_QUANTUM;
+    context->parameters.targetLatency = DEFAULT_TARGET_LATENCY;
+    context->parameters.minimumGranularity = DEFAULT_MINIMUM_GRANULARITY;
+    context->isEventDriven = true;
+    return context;
+} // End of the allocate scheduler context function
+
+/**
+ * Fills in the inputs of the process with the next processID
+ */
+static struct Process* addProcess(struct SchedulerContext* context, const struct ProcessSpecification* specification)
+{
+    struct Process* process = &context->processContainer[context->totalCreatedProcesses];
+    process->A = specification->A;
+    process->B = specification->B;
+    process->C = specification->C;
+    process->M = specification->M;
+    process->D = specification->D;
+    process->niceness = specification->niceness;
+    process->weight = getNicenessWeight(specification->niceness);
+    process->processID = context->totalCreatedProcesses;
+    process->quantum = DEFAULT_ROUND_ROBIN_QUANTUM;
+    ++context->totalCreatedProcesses;
+    return process;
+} // End of the add process function
+
+/**
+ * Creates a simulation context from an in-memory workload, ready to be stepped from cycle 0
+ */
+struct SchedulerContext* createSchedulerContext(const struct ProcessSpecification workload[], uint32_t totalProcesses,
+                                                const struct RandomNumberSource* randomSource, uint8_t schedulerAlgorithm)
+{
+    struct SchedulerContext* context = allocateSchedulerContext(totalProcesses, randomSource, schedulerAlgorithm);
+    if (context == NULL)
+        return NULL;
+
+    uint32_t i = 0;
+    for (; i < totalProcesses; ++i)
+    {
+        struct Process* process = addProcess(context, &workload[i]);
+        if (process->D != 0)
+            context->deadlineOrder[context->totalDeadlineProcesses++] = process;
+    }
+    qsort(context->deadlineOrder, context->totalDeadlineProcesses, sizeof(struct Process*), compareDeadlines);
+
+    resetSchedulerContext(context);
+    return context;
+} // End of the create scheduler context function
+
+/**
+ * Creates a simulation context for an online run, whose processes are submitted by other threads while it runs
+ */
+struct SchedulerContext* createOnlineSchedulerContext(uint32_t maximumProcesses, const struct RandomNumberSource* randomSource,
+                                                      uint8_t schedulerAlgorithm, struct SubmissionQueue* submissionQueue)
+{
+    struct SchedulerContext* context = allocateSchedulerContext(maximumProcesses, randomSource, schedulerAlgorithm);
+    if (context == NULL)
+        return NULL;
+    context->submissionQueue = submissionQueue;
+
+    resetSchedulerContext(context);
+    return context;
+} // End of the create online scheduler context function
+
+/**
+ * Admits every submitted process arriving on the current cycle, once every one of them has been submitted
+ */
+static void admitSubmissions(struct SchedulerContext* context)
+{
+    if (!waitForSubmissions(context->submissionQueue, context->currentCycle))
+    {
+        // Out of memory while collecting the submitted processes, the run stops here
+        context->failure = 3;
+        return;
+    }
+
+    const struct Submission* submission = peekSubmission(context->submissionQueue);
+    while ((submission != NULL) && (submission->specification.A <= context->currentCycle))
+    {
+        if (context->totalCreatedProcesses == context->processCapacity)
+        {
+            // Out of room for the process, the run stops here
+            context->failure = 4;
+            return;
+        }
+        struct ProcessSpecification specification;
+        popSubmission(context->submissionQueue, &specification);
+        struct Process* process = addProcess(context, &specification);
+
+        // Its bursts are drawn when it is first dispatched, as for every other process
+        resetProcess(process);
+        process->CPUBurst = 0;
+        process->IOBurst = 0;
+
+        if (process->D != 0)
+        {
+            // Inserts into the deadline order, which only ever has later deadlines at the back
+            uint32_t i = context->totalDeadlineProcesses++;
+            while ((i > context->nextDeadlineIndex)
+                   && (getAbsoluteDeadline(context->deadlineOrder[i - 1]) > getAbsoluteDeadline(process)))
+            {
+                context->deadlineOrder[i] = context->deadlineOrder[i - 1];
+                --i;
+            }
+            context->deadlineOrder[i] = process;
+        }
+        submission = peekSubmission(context->submissionQueue);
+    }
+} // End of the admit submissions function
+
+/**
+ * Checks whether the run has anything left to do: an unfinished process, or a process still to be submitted
+ */
+static bool isSchedulerRunning(const struct SchedulerContext* context)
+{
+    if (context->totalFinishedProcesses != context->totalCreatedProcesses)
+        return true;
+    return (context->submissionQueue != NULL) && !isSubmissionQueueFinished(context->submissionQueue);
+} // End of the is scheduler running function
+
+/**
+ * Releases a context created with createSchedulerContext() or createOnlineSchedulerContext()
+ */
+void destroySchedulerContext(struct SchedulerContext* context)
+{
+    if (context == NULL)
+        return;
+    free(context->processContainer);
+    free(context->finishedProcessOrder);
+    free(context->deadlineOrder);
+    free(context->readyHeap);
+    free(context);
+} // End of the destroy scheduler context function
+
+/**
+ * Completely resets every counter, timer, and anything else that was changed since the start of a run
+ */
+void resetSchedulerContext(struct SchedulerContext* context)
+{
+    context->failure = 0;
+    if (context->submissionQueue != NULL)
+    {
+        // An online run starts without any processes, which are admitted as they are submitted
+        context->totalCreatedProcesses = 0;
+        context->totalDeadlineProcesses = 0;
+    }
+
+    context->currentCycle = 0;
+    context->totalStartedProcesses = 0;
+    context->totalFinishedProcesses = 0;
+    context->totalNumberOfCyclesSpentBlocked = 0;
+    context->isFirstTimeRunningUniprogrammed = true;
+    context->uniprogrammedProcess = NULL;
+
+    // readyQueue head & tail pointers
+    context->readyHead = NULL;
+    context->readyTail = NULL;
+    context->readyProcessQueueSize = 0;
+    context->totalReadyEnqueues = 0;
+    context->runQueueRoot = NULL;
+    context->runQueueWeight = 0;
+    context->minimumVruntime = 0;
+    context->isWakeupPending = false;
+
+    // readySuspendedQueue head & tail pointers
+    context->readySuspendedHead = NULL;
+    context->readySuspendedTail = NULL;
+    context->readySuspendedProcessQueueSize = 0;
+
+    // blockedQueue head & tail pointers
+    context->blockedHead = NULL;
+    context->blockedTail = NULL;
+    context->blockedProcessListSize = 0;
+
+    context->currentRunningProcess = NULL;
+
+    context->nextDeadlineIndex = 0;
+    context->firstMissCycle = -1;
+    context->CPUTimeBeforeFirstMiss = 0;
+
+    resetLatencyHistogram(&context->turnaroundHistogram);
+    resetLatencyHistogram(&context->waitingHistogram);
+    resetLatencyHistogram(&context->responseHistogram);
+    resetLatencyHistogram(&context->readyDelayHistogram);
+    resetLatencyHistogram(&context->latenessHistogram);
+
+    // The initial bursts are drawn from the start of the random numbers, as is each simulation's first burst
+    context->randomNumberIndex = 0;
+    uint32_t i = 0;
+    for (; i < context->totalCreatedProcesses; ++i)
+    {
+        struct Process* process = &context->processContainer[i];
+        resetProcess(process);
+        if (context->burstTrace != NULL)
+        {
+            // A replayed process takes its first burst from the trace when it is first dispatched
+            process->CPUBurst = 0;
+            process->IOBurst = 0;
+            continue;
+        }
+
+        // Also draws burst 0 in counter based random mode, which is the same one the first dispatch draws
+        process->CPUBurst = randomOS(process->B, nextRandomNumber(context, process));
+        process->IOBurst = (int64_t) (process->M * process->CPUBurst);
+        process->totalCPUBursts = 0;
+    }
+    context->randomNumberIndex = 0;
+} // End of the reset scheduler context function
+
+/**
+ * Prints out the state of each process during the current cycle
+ */
+static void printCycleState(struct SchedulerContext* context)
+{
+    printf("Before cycle\t%" PRIu64 ":\t", context->currentCycle);
+    uint32_t i = 0;
+    for (; i < context->totalCreatedProcesses; ++i)
+    {
+        switch (context->processContainer[i].status)
+        {
+            case 0:
+                // Node has not started
+                printf("unstarted \t0\t");
+                break;
+            case 1:
+                // Node is ready
+                printf("ready   \t0\t");
+                break;
+            case 2:
+                // Node is running
+                printf("running \t%" PRId64 "\t", (int64_t) context->processContainer[i].CPUBurst + 1);
+                break;
+            case 3:
+                // Node is I/O blocked
+                printf("blocked \t%" PRId64 "\t", context->processContainer[i].IOBurst + 1);
+                break;
+            case 4:
+                // Node is terminated
+                printf("terminated \t0\t");
+                break;
+            default:
+                // Invalid node status, the run stops at the end of this cycle
+                context->failure = 2;
+                break;
+        } // End of the per process status print statement
+    } // End of the per line for loop
+    printf("\n");
+} // End of the print cycle state function
+
+/**
+ * Simulates a single cycle of the scheduler
+ * @return true if there are still unfinished processes, false once the simulation is complete
+ */
+bool stepScheduler(struct SchedulerContext* context)
+{
+    if (context->failure != 0)
+        return false;
+
+    if (context->submissionQueue != NULL)
+    {
+        admitSubmissions(context);
+        if (context->failure != 0)
+            return false;
+    }
+
+    if (context->isVerboseMode)
+        printCycleState(context);
+
+    // Checked before any process terminates this cycle, as those finish after their deadline too
+    if (context->firstMissCycle == -1)
+        findFirstDeadlineMiss(context);
+
+    doRunningProcesses(context);
+    doBlockedProcesses(context);
+
+    if (context->totalStartedProcesses != context->totalCreatedProcesses)
+    {
+        // Not all processes created, goes into creation loop
+        createProcesses(context);
+    }
+
+    doReadyProcesses(context);
+    incrementTimers(context);
+
+    bool isStillRunning = isSchedulerRunning(context) && (context->failure == 0);
+    if (context->telemetry != NULL)
+    {
+        // The cycle the last process terminates on is not part of the run (see the summary finishing time)
+        if (isStillRunning)
+            recordTelemetryCycle(context->telemetry, context);
+        else
+            finishTelemetryRun(context->telemetry, context);
+    }
+
+    ++context->currentCycle;
+    return isStillRunning;
+} // End of the step scheduler function
+
+/**
+ * Jumps over the cycles in which nothing can happen: with no process running, ready or suspended, each cycle only
+ * counts down the blocked processes, until one unblocks, a process arrives or a deadline passes
+ * @return The number of cycles skipped (0 if the next cycle has to be simulated)
+ */
+uint64_t skipIdleCycles(struct SchedulerContext* context)
+{
+    if ((context->failure != 0) || !context->isEventDriven || context->isVerboseMode
+        || (context->currentRunningProcess != NULL)
+        || (context->readyProcessQueueSize != 0) || (context->readySuspendedProcessQueueSize != 0)
+        || !isSchedulerRunning(context))
+        return 0;
+
+    // Finds the next cycle on which something happens
+    uint64_t cyclesToSkip = UINT64_MAX;
+    struct Process* currentNode = context->blockedHead;
+    for (; currentNode != NULL; currentNode = currentNode->nextInBlockedList)
+    {
+        // A process can overshoot to below 0 when the blocked list is only partly checked on a cycle
+        if (currentNode->IOBurst <= 0)
+            return 0;
+        if ((uint64_t) currentNode->IOBurst < cyclesToSkip)
+            cyclesToSkip = (uint64_t) currentNode->IOBurst;
+    }
+    uint32_t i = 0;
+    for (; i < context->totalCreatedProcesses; ++i)
+    {
+        const struct Process* process = &context->processContainer[i];
+        if ((process->status == 0) && (process->A - context->currentCycle < cyclesToSkip))
+            cyclesToSkip = process->A - context->currentCycle;
+    }
+    if ((context->firstMissCycle == -1) && (context->nextDeadlineIndex < context->totalDeadlineProcesses))
+    {
+        // The deadline is first seen to have passed on the cycle after it
+        uint64_t deadline = getAbsoluteDeadline(context->deadlineOrder[context->nextDeadlineIndex]);
+        if (deadline + 1 - context->currentCycle < cyclesToSkip)
+            cyclesToSkip = deadline + 1 - context->currentCycle;
+    }
+    if (context->submissionQueue != NULL)
+    {
+        // Stops at the next submitted arrival, and before any cycle that could still have processes submitted for it
+        if (!collectSubmissions(context->submissionQueue))
+            return 0;
+        const struct Submission* submission = peekSubmission(context->submissionQueue);
+        if ((submission != NULL) && (submission->specification.A - context->currentCycle < cyclesToSkip))
+            cyclesToSkip = submission->specification.A - context->currentCycle;
+        uint64_t watermark = getSubmissionWatermark(context->submissionQueue);
+        uint64_t cyclesToWatermark = (watermark > context->currentCycle) ? watermark - context->currentCycle : 0;
+        if (cyclesToWatermark < cyclesToSkip)
+            cyclesToSkip = cyclesToWatermark;
+    }
+    if ((cyclesToSkip == 0) || (cyclesToSkip == UINT64_MAX))
+        return 0;
+
+    // Does the work of incrementTimers() for each of the skipped cycles at once
+    for (currentNode = context->blockedHead; currentNode != NULL; currentNode = currentNode->nextInBlockedList)
+    {
+        currentNode->currentIOBlockedTime += cyclesToSkip;
+        currentNode->IOBurst -= (int64_t) cyclesToSkip;
+    }
+    if (context->blockedProcessListSize != 0)
+        context->totalNumberOfCyclesSpentBlocked += cyclesToSkip;
+    if (context->telemetry != NULL)
+        recordTelemetryCycles(context->telemetry, context, cyclesToSkip);
+
+    context->currentCycle += cyclesToSkip;
+    return cyclesToSkip;
+} // End of the skip idle cycles function
+
+/**
+ * Simulates cycles until every process has terminated, skipping over idle cycles when event driven
+ */
+void runScheduler(struct SchedulerContext* context)
+{
+    while (isSchedulerRunning(context) && (context->failure == 0))
+    {
+        skipIdleCycles(context);
+        stepScheduler(context);
+    }
+} // End of the run scheduler function
+
+/**
+ * Describes why a run was stopped short
+ */
+const char* describeSchedulerFailure(const struct SchedulerContext* context)
+{
+    switch (context->failure)
+    {
+        case 0:
+            return NULL;
+        case 1:
+            return "ran out of random numbers";
+        case 2:
+            return "invalid process status code";
+        case 3:
+            return "out of memory while collecting submitted processes";
+        case 4:
+            return "more processes were submitted than the context has room for";
+        default:
+            return "unknown failure";
+    }
+} // End of the describe scheduler failure function
+
+/**
+ * Retrieves the results of a single process
+ */
+bool getProcessMetrics(const struct SchedulerContext* context, uint32_t processID, struct ProcessMetrics* metrics)
+{
+    if (processID >= context->totalCreatedProcesses)
+        return false;
+
+    const struct Process* process = &context->processContainer[processID];
+    metrics->processID = process->processID;
+    metrics->A = process->A;
+    metrics->B = process->B;
+    metrics->C = process->C;
+    metrics->M = process->M;
+    metrics->D = process->D;
+    metrics->niceness = process->niceness;
+    metrics->finishingTime = process->finishingTime;
+    metrics->turnaroundTime = process->finishingTime - process->A;
+    metrics->CPUTime = process->currentCPUTimeRun;
+    metrics->IOTime = process->currentIOBlockedTime;
+    metrics->waitingTime = process->currentWaitingTime;
+    metrics->lateness = (process->D == 0) ? 0 : (int64_t) (process->finishingTime - getAbsoluteDeadline(process));
+    return true;
+} // End of the get process metrics function
+
+/**
+ * Retrieves the summary results of a completed run
+ */
+void getSummaryMetrics(const struct SchedulerContext* context, struct SummaryMetrics* metrics)
+{
+    uint32_t i = 0;
+    double totalAmountOfTimeUtilisingCPU = 0.0;
+    double totalAmountOfTimeSpentWaiting = 0.0;
+    double totalTurnaroundTime = 0.0;
+    double totalProgressRate = 0.0;
+    double totalSquaredProgressRate = 0.0;
+    uint64_t finalFinishingTime = context->currentCycle - 1;
+    for (; i < context->totalCreatedProcesses; ++i)
+    {
+        const struct Process* process = &context->processContainer[i];
+        totalAmountOfTimeUtilisingCPU += process->currentCPUTimeRun;
+        totalAmountOfTimeSpentWaiting += process->currentWaitingTime;
+        // Each total is summed as a double, which holds any 64 bit cycle count to within 1 part in 2^53. The difference
+        // is taken first, so that a short turnaround late in a long run is not rounded away
+        double turnaroundTime = (double) (process->finishingTime - process->A);
+        totalTurnaroundTime += turnaroundTime;
+
+        // The fraction of its time in the system that the process spent making progress, rather than waiting
+        double progressRate = (turnaroundTime <= 0) ? 1.0 :
+                ((double) process->currentCPUTimeRun + process->currentIOBlockedTime) / turnaroundTime;
+        totalProgressRate += progressRate;
+        totalSquaredProgressRate += progressRate * progressRate;
+    }
+
+    metrics->finishingTime = finalFinishingTime;
+
+    // Calculates the CPU utilisation
+    metrics->CPUUtilisation = totalAmountOfTimeUtilisingCPU / (double) finalFinishingTime;
+
+    // Calculates the IO utilisation
+    metrics->IOUtilisation = (double) context->totalNumberOfCyclesSpentBlocked / (double) finalFinishingTime;
+
+    // Calculates the throughput (Number of processes over the final finishing time times 100)
+    metrics->throughput = 100 * ((double) context->totalCreatedProcesses / (double) finalFinishingTime);
+
+    // Calculates the average turnaround time
+    metrics->averageTurnaroundTime = totalTurnaroundTime / context->totalCreatedProcesses;
+
+    // Calculates the average waiting time
+    metrics->averageWaitingTime = totalAmountOfTimeSpentWaiting / context->totalCreatedProcesses;
+
+    // Calculates Jain's fairness index of the progress rates, which is 1 when every process progressed equally fast
+    metrics->fairnessIndex = (totalSquaredProgressRate == 0) ? 1.0 :
+            (totalProgressRate * totalProgressRate) / (context->totalCreatedProcesses * totalSquaredProgressRate);
+
+    // Calculates the deadline misses and average lateness, over only the processes with a deadline
+    double totalLateness = 0.0;
+    metrics->totalDeadlineMisses = 0;
+    for (i = 0; i < context->totalDeadlineProcesses; ++i)
+    {
+        const struct Process* process = context->deadlineOrder[i];
+        double lateness = (double) (int64_t) (process->finishingTime - getAbsoluteDeadline(process));
+        totalLateness += lateness;
+        if (lateness > 0)
+            ++metrics->totalDeadlineMisses;
+    }
+    metrics->totalDeadlineProcesses = context->totalDeadlineProcesses;
+    metrics->averageLateness = (context->totalDeadlineProcesses == 0) ? 0.0 : totalLateness / context->totalDeadlineProcesses;
+    metrics->firstMissCycle = context->firstMissCycle;
+    metrics->firstMissCPUUtilisation = (context->firstMissCycle <= 0) ? 0.0 :
+            (double) context->CPUTimeBeforeFirstMiss / context->firstMissCycle;
+} // End of the get summary metrics function
+
+/**
+ * Adds the latency histograms of one run into another, e.g. to combine the results of runs done in parallel
+ */
+void mergeSchedulerLatencies(struct SchedulerContext* destination, const struct SchedulerContext* source)
+{
+    mergeLatencyHistograms(&destination->turnaroundHistogram, &source->turnaroundHistogram);
+    mergeLatencyHistograms(&destination->waitingHistogram, &source->waitingHistogram);
+    mergeLatencyHistograms(&destination->responseHistogram, &source->responseHistogram);
+    mergeLatencyHistograms(&destination->readyDelayHistogram, &source->readyDelayHistogram);
+    mergeLatencyHistograms(&destination->latenessHistogram, &source->latenessHistogram);
+} // End of the merge scheduler latencies function
+
+/************************ END OF CONTEXT FUNCTIONS *************************************/
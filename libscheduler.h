@@ -0,0 +1,337 @@
+#ifndef LIBSCHEDULER_H
+#define LIBSCHEDULER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "latencyHistogram.h"
+
+struct TelemetryRecorder;               // See telemetry.h
+struct SubmissionQueue;                 // See submissionQueue.h
+struct BurstTrace;                      // See traceImporter.h
+
+/* Defines a job struct */
+struct Process {
+    uint64_t A;                         // A: Arrival time of the process
+    uint64_t B;                         // B: Upper Bound of CPU burst times of the given random integer list
+    uint64_t C;                         // C: Total CPU time required
+    uint64_t M;                         // M: Multiplier of CPU burst time
+    uint64_t D;                         // D: Relative deadline, counted from the arrival time (0 for no deadline)
+    int32_t niceness;                   // N: The CFS niceness, from -20 (most CPU) to 19 (least CPU)
+    uint32_t processID;                 // The process ID given upon input read
+
+    uint8_t status;                     // 0 is unstarted, 1 is ready, 2 is running, 3 is blocked, 4 is terminated
+
+    uint64_t finishingTime;             // The cycle when the the process finishes (initially UINT64_MAX)
+    uint64_t currentCPUTimeRun;         // The amount of time the process has already run (time in running state)
+    uint64_t currentIOBlockedTime;      // The amount of time the process has been IO blocked (time in blocked state)
+    uint64_t currentWaitingTime;        // The amount of time spent waiting to be run (time in ready state)
+    int64_t firstDispatchCycle;         // The cycle when the process first started running (initially -1)
+    uint64_t readySinceCycle;           // The cycle when the process last moved to the ready state
+    uint64_t readySequence;             // Orders processes with equal deadlines in the EDF ready queue (first come first)
+
+    int64_t IOBurst;                    // The amount of time until the process finishes being blocked
+    uint64_t CPUBurst;                  // The CPU availability of the process (has to be > 1 to move to running)
+    uint64_t totalCPUBursts;            // The number of CPU bursts drawn so far (the burst index of the next one)
+
+    int64_t quantum;                    // Used for schedulers that utilise pre-emption
+
+    uint32_t weight;                    // CFS: The load weight of the niceness (1024 at niceness 0)
+    uint64_t vruntime;                  // CFS: Time run, weighted by niceness, in 1024ths of a cycle at niceness 0
+    struct Process* runQueueLeft;       // CFS: The children of the process in the run queue tree
+    struct Process* runQueueRight;
+    uint8_t runQueueHeight;             // CFS: The height of the subtree rooted at the process (1 for a leaf)
+
+    bool isFirstTimeRunning;            // Used to check when to calculate the CPU burst when it hits running mode
+
+    struct Process* nextInBlockedList;  // A pointer to the next process available in the blocked list
+    struct Process* nextInReadyQueue;   // A pointer to the next process available in the ready queue
+    struct Process* nextInReadySuspendedQueue; // A pointer to the next process available in the ready suspended queue
+};
+
+/*
+ * The first binary mix format starts with these 4 bytes, followed by the number of processes and then the A, B, C and M
+ * of each process in turn, all as little endian 32 bit unsigned integers
+ */
+#define BINARY_WORKLOAD_MAGIC "ABCM"
+
+/*
+ * Every later binary mix format starts with these 4 bytes, followed by its version as a little endian 32 bit unsigned
+ * integer. Version 2 then holds the number of processes as a little endian 32 bit unsigned integer, and then for each
+ * process in turn its A, B, C, M and D as little endian 64 bit unsigned integers and its niceness N as a little endian
+ * 32 bit two's complement integer
+ */
+#define VERSIONED_BINARY_WORKLOAD_MAGIC "ABCV"
+#define BINARY_WORKLOAD_VERSION 2       // The latest version of the binary mix format
+
+// The most processes a mix may hold, one short of UINT32_MAX so that every per process array has room for one more
+#define MAXIMUM_WORKLOAD_PROCESSES (UINT32_MAX - 1)
+
+/* Defines a single process of an input mix, in the ABCM format, with an optional fifth value D and sixth value N */
+struct ProcessSpecification {
+    uint64_t A;                         // A: Arrival time of the process
+    uint64_t B;                         // B: Upper Bound of CPU burst times of the given random integer list
+    uint64_t C;                         // C: Total CPU time required
+    uint64_t M;                         // M: Multiplier of CPU burst time
+    uint64_t D;                         // D: Relative deadline, counted from the arrival time (0 for no deadline)
+    int32_t niceness;                   // N: The CFS niceness, from -20 to 19 (0 if left out)
+};
+
+/*
+ * The "random" numbers used to calculate CPU bursts, shared read-only between contexts. Either read once into memory
+ * from a file and used in sequence, or (when counter based) calculated from the seed, process ID and burst index, so
+ * that each burst is the same whatever order the processes are scheduled in, and there is no limit on the draws.
+ */
+struct RandomNumberSource {
+    uint32_t* randomNumbers;            // Every number in the random number file, in file order
+    uint32_t totalRandomNumbers;        // The number of entries in randomNumbers
+    bool isCounterBased;                // Whether the numbers are calculated from the seed instead
+    uint64_t seed;                      // The seed of the counter based numbers
+};
+
+// The default values of the tunable parameters
+#define DEFAULT_ROUND_ROBIN_QUANTUM 2   // Value provided as described in requirements
+#define DEFAULT_TARGET_LATENCY 16
+#define DEFAULT_MINIMUM_GRANULARITY 2
+
+// Raised whenever a change to the engine changes the results of any run, which invalidates every cached result
+#define SCHEDULER_ENGINE_VERSION 1
+
+/* The tunable parameters of the scheduler algorithms, which may be changed before each run */
+struct SchedulerParameters {
+    int32_t roundRobinQuantum;          // RR: The cycles a process runs for before it is preempted
+    uint32_t targetLatency;             // CFS: The cycles over which every runnable process should get to run once
+    uint32_t minimumGranularity;        // CFS: The fewest cycles a process runs for before it may be preempted
+};
+
+/* The results of a single process, as printed out in the process specifics */
+struct ProcessMetrics {
+    uint32_t processID;                 // The process ID given upon input read
+    uint64_t A;                         // A: Arrival time of the process
+    uint64_t B;                         // B: Upper Bound of CPU burst times of the given random integer list
+    uint64_t C;                         // C: Total CPU time required
+    uint64_t M;                         // M: Multiplier of CPU burst time
+    uint64_t D;                         // D: Relative deadline (0 for no deadline)
+    int32_t niceness;                   // N: The CFS niceness
+    uint64_t finishingTime;             // The cycle when the process finished (UINT64_MAX if it has not finished yet)
+    uint64_t turnaroundTime;            // The finishing time minus the arrival time
+    uint64_t CPUTime;                   // The amount of time spent in the running state
+    uint64_t IOTime;                    // The amount of time spent in the blocked state
+    uint64_t waitingTime;               // The amount of time spent in the ready state
+    int64_t lateness;                   // The finishing time minus the absolute deadline (A + D), 0 with no deadline
+};
+
+/* The results of a whole run, as printed out in the summary data */
+struct SummaryMetrics {
+    uint64_t finishingTime;             // The cycle on which the last process finished
+    double CPUUtilisation;              // The fraction of cycles the CPU was running a process
+    double IOUtilisation;               // The fraction of cycles at least one process was blocked
+    double throughput;                  // Processes finished per hundred cycles
+    double averageTurnaroundTime;
+    double averageWaitingTime;
+    double fairnessIndex;               // Jain's index of each process's progress rate ((CPU + I/O time) / turnaround)
+
+    // Only meaningful when some processes have deadlines, whatever the scheduler algorithm
+    uint32_t totalDeadlineProcesses;    // The number of processes with a deadline
+    uint32_t totalDeadlineMisses;       // The number of those that finished after their deadline
+    double averageLateness;             // The mean finishing time minus absolute deadline (negative when early)
+    int64_t firstMissCycle;             // The cycle the first deadline was missed on (-1 if none were)
+    double firstMissCPUUtilisation;     // The CPU utilisation over the cycles before the first miss
+};
+
+/* All state of a single simulation, so that any number of simulations may be run side by side */
+struct SchedulerContext {
+    uint8_t schedulerAlgorithm;         // 0 = FCFS, 1 = RR, 2 = UNI, 3 = SJF, 4 = EDF, 5 = CFS
+    struct SchedulerParameters parameters; // The defaults unless changed, which takes effect from the next dispatch
+    bool isVerboseMode;                 // Prints the state and remaining burst of each process before each cycle
+    bool isRandomMode;                  // Prints each random number as it is used
+    bool isEventDriven;                 // Lets runScheduler() skip over idle cycles (true unless changed)
+
+    const struct RandomNumberSource* randomSource;
+    uint32_t randomNumberIndex;         // The number of entries of the random source used so far
+    uint32_t randomNumberOffset;        // The entry of the random source to start from (0 unless replicating a run)
+    // Replays process i's CPU and I/O bursts from task i of a trace (NULL to draw them), reset the context after setting it
+    const struct BurstTrace* burstTrace;
+
+    struct Process* processContainer;   // The processes, in input order (processID == index)
+    uint32_t processCapacity;           // The number of processes processContainer has room for
+    struct SubmissionQueue* submissionQueue; // Admits processes while the simulation runs (NULL for a fixed workload)
+    uint32_t* finishedProcessOrder;     // The processIDs of the terminated processes, in the order they finished
+
+    bool isFirstTimeRunningUniprogrammed;
+    struct Process* uniprogrammedProcess;
+
+    uint64_t currentCycle;              // The current cycle that each process is on
+    uint32_t totalCreatedProcesses;     // The total number of processes constructed
+    uint32_t totalStartedProcesses;     // The total number of processes that have started being simulated
+    uint32_t totalFinishedProcesses;    // The total number of processes that have finished running
+    uint64_t totalNumberOfCyclesSpentBlocked;
+
+    // readyQueue head & tail pointers
+    struct Process* readyHead;
+    struct Process* readyTail;
+    uint32_t readyProcessQueueSize;
+
+    // The ready queue of EDF instead, a binary min heap ordered by absolute deadline (readyProcessQueueSize entries)
+    struct Process** readyHeap;
+    uint64_t totalReadyEnqueues;        // Hands out each readySequence
+
+    // The ready queue of CFS instead, a balanced (AVL) tree ordered by vruntime (readyProcessQueueSize entries)
+    struct Process* runQueueRoot;
+    uint64_t runQueueWeight;            // The total weight of every process in the run queue
+    uint64_t minimumVruntime;           // Only ever increases, used to place processes joining the run queue
+    bool isWakeupPending;               // Whether a process joined the run queue since the last preemption check
+
+    // readySuspendedQueue head & tail pointers
+    struct Process* readySuspendedHead;
+    struct Process* readySuspendedTail;
+    uint32_t readySuspendedProcessQueueSize;
+
+    // blockedList head & tail pointers
+    struct Process* blockedHead;
+    struct Process* blockedTail;
+    uint32_t blockedProcessListSize;
+
+    struct Process* currentRunningProcess;
+
+    // The processes with a deadline, sorted by absolute deadline, checked off in turn to find the first miss
+    struct Process** deadlineOrder;
+    uint32_t totalDeadlineProcesses;
+    uint32_t nextDeadlineIndex;         // The first entry of deadlineOrder whose deadline has not yet passed
+    int64_t firstMissCycle;             // The cycle the first deadline was missed on (-1 if none have been)
+    uint64_t CPUTimeBeforeFirstMiss;    // The cycles spent running processes before the first miss
+
+    // Latency distributions, recorded as the simulation runs
+    struct LatencyHistogram turnaroundHistogram;    // Finishing time minus A, per process
+    struct LatencyHistogram waitingHistogram;       // Total time in the ready state, per process
+    struct LatencyHistogram responseHistogram;      // First dispatch minus A, per process
+    struct LatencyHistogram readyDelayHistogram;    // Time from becoming ready to being dispatched, per CPU burst
+    struct LatencyHistogram latenessHistogram;      // Finishing time minus deadline (0 if met), per deadline process
+
+    struct TelemetryRecorder* telemetry;            // Aggregates the state of each cycle when set (NULL to disable)
+
+    // Why the run was stopped short: 0 = it was not, 1 = ran out of random numbers, 2 = invalid process status,
+    // 3 = out of memory collecting submissions, 4 = more processes submitted than processCapacity
+    uint8_t failure;
+};
+
+/**
+ * Reads every number from a random number file (e.g. random-numbers) into memory
+ * @param fileName The path of the random number file
+ * @param randomSource The source to fill in, to be released with freeRandomNumberSource()
+ * @return true on success, false if the file could not be read
+ */
+bool loadRandomNumberSource(const char* fileName, struct RandomNumberSource* randomSource);
+
+/**
+ * Sets up a random number source that calculates each number from a seed, instead of reading a file
+ */
+void initialiseCounterBasedRandomSource(uint64_t seed, struct RandomNumberSource* randomSource);
+
+/**
+ * Calculates the "random" number of a single CPU burst in O(1), independently of every other burst
+ * @param seed The seed of the run
+ * @param processID The process the burst belongs to
+ * @param burstIndex Which burst of the process this is, counting from 0
+ * @return A non-negative integer below 2^31, as found in the random number file
+ */
+uint32_t counterBasedRandomNumber(uint64_t seed, uint32_t processID, uint64_t burstIndex);
+
+/**
+ * Releases the memory held by a random number source
+ */
+void freeRandomNumberSource(struct RandomNumberSource* randomSource);
+
+/**
+ * Reads a mix in the ABCM format, e.g. "2 (0 1 5 1) (0 1 5 1 40 -5)" (with an optional deadline D, and then an
+ * optional niceness N), or in either binary format (the first of which has neither)
+ * @param inputFile The file to read the mix from
+ * @param workload Set to a newly allocated array of the processes read, to be released with free()
+ * @param totalProcesses Set to the number of processes read
+ * @return true on success, false if the mix is malformed, holds more than MAXIMUM_WORKLOAD_PROCESSES processes, or
+ * does not fit in memory
+ */
+bool readWorkload(FILE* inputFile, struct ProcessSpecification** workload, uint32_t* totalProcesses);
+
+/**
+ * Creates a simulation context from an in-memory workload, ready to be stepped from cycle 0, with the default parameters
+ * @param workload The processes to simulate, in input order
+ * @param totalProcesses The number of processes in workload
+ * @param randomSource The random numbers to use, which must outlive the context
+ * @param schedulerAlgorithm Which scheduler algorithm to run. 0 = FCFS, 1 = RR, 2 = UNI, 3 = SJF, 4 = EDF, 5 = CFS.
+ * @return The new context, or NULL if out of memory
+ */
+struct SchedulerContext* createSchedulerContext(const struct ProcessSpecification workload[], uint32_t totalProcesses,
+                                                const struct RandomNumberSource* randomSource, uint8_t schedulerAlgorithm);
+
+/**
+ * Creates a simulation context for an online run, whose processes are submitted by other threads while it runs, through
+ * a submission queue. Each cycle is only simulated once every producer has moved its watermark past it (stepScheduler()
+ * waits until then), and the run finishes once every producer has been closed and every process has terminated.
+ * Processes are given their processIDs in the order they are admitted.
+ * @param maximumProcesses The most processes that may be submitted over the run (submitting more fails the run)
+ * @param randomSource The random numbers to use, which must outlive the context
+ * @param schedulerAlgorithm Which scheduler algorithm to run. 0 = FCFS, 1 = RR, 2 = UNI, 3 = SJF, 4 = EDF, 5 = CFS.
+ * @param submissionQueue The queue the processes are submitted through, which must outlive the context. Each context
+ * needs its own queue, and resetting the context forgets every admitted process, so each queue feeds a single run.
+ * @return The new context, or NULL if out of memory
+ */
+struct SchedulerContext* createOnlineSchedulerContext(uint32_t maximumProcesses, const struct RandomNumberSource* randomSource,
+                                                      uint8_t schedulerAlgorithm, struct SubmissionQueue* submissionQueue);
+
+/**
+ * Releases a context created with createSchedulerContext() or createOnlineSchedulerContext()
+ */
+void destroySchedulerContext(struct SchedulerContext* context);
+
+/**
+ * Completely resets every counter, timer, and queue so that the context can be run again from cycle 0
+ */
+void resetSchedulerContext(struct SchedulerContext* context);
+
+/**
+ * Simulates a single cycle, first admitting any submitted process arriving on it in an online run
+ * @return true if there are still unfinished (or, in an online run, still to be submitted) processes, false once the
+ * simulation is complete, or once it has failed (see describeSchedulerFailure())
+ */
+bool stepScheduler(struct SchedulerContext* context);
+
+/**
+ * Skips over the cycles in which no process can run, arrive or unblock (and no deadline can pass), which only count down
+ * the blocked processes. Does nothing unless the context is event driven, nor in verbose mode, which prints every cycle.
+ * The results are the same as stepping through each of those cycles.
+ * @return The number of cycles skipped (0 if the next cycle has to be simulated with stepScheduler())
+ */
+uint64_t skipIdleCycles(struct SchedulerContext* context);
+
+/**
+ * Simulates cycles until every process has terminated, skipping over idle cycles when event driven. Stops early if the
+ * run fails, which leaves the results incomplete (see describeSchedulerFailure())
+ */
+void runScheduler(struct SchedulerContext* context);
+
+/**
+ * Describes why a run was stopped short, such as by running out of random numbers
+ * @return A description of the failure, or NULL if the run has not failed
+ */
+const char* describeSchedulerFailure(const struct SchedulerContext* context);
+
+/**
+ * Retrieves the results of a single process
+ * @param processID The process to query, given by its index in the input
+ * @return false if there is no such process
+ */
+bool getProcessMetrics(const struct SchedulerContext* context, uint32_t processID, struct ProcessMetrics* metrics);
+
+/**
+ * Retrieves the summary results of a completed run
+ */
+void getSummaryMetrics(const struct SchedulerContext* context, struct SummaryMetrics* metrics);
+
+/**
+ * Adds the latency histograms of one run into another, e.g. to combine the results of runs done in parallel
+ */
+void mergeSchedulerLatencies(struct SchedulerContext* destination, const struct SchedulerContext* source);
+
+#endif // LIBSCHEDULER_H
@@ -0,0 +1,56 @@
+#ifndef MONTE_CARLO_H
+#define MONTE_CARLO_H
+
+#include <stdint.h>
+
+#include "libscheduler.h"
+#include "latencyHistogram.h"
+
+/* The spread of a single summary metric over every replication */
+struct MetricEstimate {
+    double mean;
+    double standardDeviation;           // The sample standard deviation
+    double confidenceHalfWidth;         // The 95% confidence interval is mean +/- this (Student's t)
+};
+
+/* The summary data of a workload, aggregated over many replications of the same run */
+struct ReplicationSummary {
+    uint32_t totalReplications;
+    struct MetricEstimate finishingTime;
+    struct MetricEstimate CPUUtilisation;
+    struct MetricEstimate IOUtilisation;
+    struct MetricEstimate throughput;
+    struct MetricEstimate averageTurnaroundTime;
+    struct MetricEstimate averageWaitingTime;
+
+    // The latency distributions of every replication merged together
+    struct LatencyHistogram turnaroundHistogram;
+    struct LatencyHistogram waitingHistogram;
+    struct LatencyHistogram responseHistogram;
+    struct LatencyHistogram readyDelayHistogram;
+};
+
+/**
+ * Runs the same workload many times, each with different random numbers, spread over worker threads.
+ * With a random number file, replication r starts from a different (pseudo randomly chosen) line of the file,
+ * and with counter based random numbers, replication r uses the seed plus r. Replication 0 is always the normal run.
+ * @param workload The processes to simulate, in input order
+ * @param totalProcesses The number of processes in workload
+ * @param randomSource The random numbers to use
+ * @param schedulerAlgorithm Which scheduler algorithm to run. 0 = FCFS, 1 = RR, 2 = UNI, 3 = SJF, 4 = EDF, 5 = CFS.
+ * @param parameters The round robin quantum and CFS parameters of every run
+ * @param totalReplications The number of runs (at least 1)
+ * @param totalThreads The number of worker threads (at least 1)
+ * @param summary Filled in with the aggregated results
+ * @return false if out of memory or the threads could not be started
+ */
+bool runReplications(const struct ProcessSpecification workload[], uint32_t totalProcesses,
+                     const struct RandomNumberSource* randomSource, uint8_t schedulerAlgorithm,
+                     const struct SchedulerParameters* parameters, uint32_t totalReplications, uint32_t totalThreads, struct ReplicationSummary* summary);
+
+/**
+ * Calculates the mean, standard deviation and 95% confidence interval of a set of samples
+ */
+void estimateMetric(const double samples[], uint32_t totalSamples, struct MetricEstimate* estimate);
+
+#endif // MONTE_CARLO_H
@@ -0,0 +1,775 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "reportWriter.h"
+
+/************************ START OF REPORT BUFFER FUNCTIONS *************************************/
+
+void initialiseReportBuffer(struct ReportBuffer* buffer)
+{
+    buffer->data = NULL;
+    buffer->length = 0;
+    buffer->capacity = 0;
+} // End of the initialise report buffer function
+
+void freeReportBuffer(struct ReportBuffer* buffer)
+{
+    free(buffer->data);
+    initialiseReportBuffer(buffer);
+} // End of the free report buffer function
+
+/**
+ * Makes sure there is room for at least extraLength more bytes in the buffer
+ */
+static void reserveReportBuffer(struct ReportBuffer* buffer, size_t extraLength)
+{
+    if (buffer->length + extraLength <= buffer->capacity)
+        return;
+
+    size_t newCapacity = (buffer->capacity == 0) ? 4096 : buffer->capacity;
+    while (newCapacity < buffer->length + extraLength)
+        newCapacity *= 2;
+
+    char* grownData = realloc(buffer->data, newCapacity);
+    if (grownData == NULL)
+    {
+        // Out of memory, exiting now
+        fprintf(stderr, "Error: out of memory while writing the report, exiting now!\n");
+        exit(1);
+    }
+    buffer->data = grownData;
+    buffer->capacity = newCapacity;
+} // End of the reserve report buffer function
+
+/**
+ * Writes out everything in the buffer with a single write, and empties it
+ */
+void flushReportBuffer(struct ReportBuffer* buffer, FILE* outputFile)
+{
+    if (buffer->length != 0)
+        fwrite(buffer->data, 1, buffer->length, outputFile);
+    buffer->length = 0;
+} // End of the flush report buffer function
+
+void appendString(struct ReportBuffer* buffer, const char* string)
+{
+    size_t stringLength = strlen(string);
+    reserveReportBuffer(buffer, stringLength);
+    memcpy(buffer->data + buffer->length, string, stringLength);
+    buffer->length += stringLength;
+} // End of the append string function
+
+void appendCharacter(struct ReportBuffer* buffer, char character)
+{
+    reserveReportBuffer(buffer, 1);
+    buffer->data[buffer->length++] = character;
+} // End of the append character function
+
+/**
+ * Appends the decimal digits of an unsigned integer, padded with leading zeroes to at least minimumDigits
+ */
+static void appendDigits(struct ReportBuffer* buffer, uint64_t value, uint8_t minimumDigits)
+{
+    // Fills in the digits backwards, from the least significant
+    char digits[20];
+    uint8_t totalDigits = 0;
+    do
+    {
+        digits[sizeof(digits) - 1 - totalDigits] = (char) ('0' + (value % 10));
+        value /= 10;
+        ++totalDigits;
+    } while ((value != 0) || (totalDigits < minimumDigits));
+
+    reserveReportBuffer(buffer, totalDigits);
+    memcpy(buffer->data + buffer->length, digits + sizeof(digits) - totalDigits, totalDigits);
+    buffer->length += totalDigits;
+} // End of the append digits function
+
+/**
+ * Appends a signed integer, formatted identically to printf("%lli")
+ */
+void appendInteger(struct ReportBuffer* buffer, int64_t value)
+{
+    if (value < 0)
+    {
+        appendCharacter(buffer, '-');
+        appendDigits(buffer, 0 - (uint64_t) value, 1);
+    }
+    else
+        appendDigits(buffer, (uint64_t) value, 1);
+} // End of the append integer function
+
+/**
+ * Appends an unsigned integer, formatted identically to printf("%llu")
+ */
+void appendUnsignedInteger(struct ReportBuffer* buffer, uint64_t value)
+{
+    appendDigits(buffer, value, 1);
+} // End of the append unsigned integer function
+
+/**
+ * Appends a real number with 6 decimal places, formatted identically to printf("%6f")
+ * NOTE: The value is rounded exactly (half to even, as printf does), so the output is byte-identical
+ */
+void appendFixedPoint(struct ReportBuffer* buffer, double value)
+{
+    if (!isfinite(value) || (fabs(value) >= 1e12))
+    {
+        // Rare enough (e.g. an empty mix dividing by zero) to simply hand over to printf
+        char formatted[400];
+        snprintf(formatted, sizeof(formatted), "%6f", value);
+        appendString(buffer, formatted);
+        return;
+    }
+
+    if (signbit(value))
+        appendCharacter(buffer, '-');
+
+    // Splits the value into significand * 2^exponent, with the significand an exact 53 bit integer
+    int32_t exponent;
+    double mantissa = frexp(fabs(value), &exponent);
+    uint64_t significand = (uint64_t) ldexp(mantissa, 53);
+    exponent -= 53;
+
+    // Calculates the value in millionths, rounding half to even
+    uint64_t scaledValue;
+    if (exponent >= 0)
+        scaledValue = (significand << exponent) * 1000000;
+    else if (exponent <= -74)
+        scaledValue = 0;                // Less than half of a millionth
+    else
+    {
+        uint32_t shift = (uint32_t) -exponent;
+        unsigned __int128 product = (unsigned __int128) significand * 1000000;
+        unsigned __int128 remainder = product & ((((unsigned __int128) 1) << shift) - 1);
+        unsigned __int128 half = ((unsigned __int128) 1) << (shift - 1);
+        scaledValue = (uint64_t) (product >> shift);
+        if ((remainder > half) || ((remainder == half) && ((scaledValue & 1) == 1)))
+            ++scaledValue;
+    }
+
+    appendDigits(buffer, scaledValue / 1000000, 1);
+    appendCharacter(buffer, '.');
+    appendDigits(buffer, scaledValue % 1000000, 6);
+} // End of the append fixed point function
+
+/************************ END OF REPORT BUFFER FUNCTIONS *************************************/
+
+/************************ START OF REPORT SECTION FUNCTIONS *************************************/
+
+/**
+ * Returns the name of a scheduler algorithm, e.g. "First Come First Serve"
+ */
+const char* getSchedulerAlgorithmName(uint8_t schedulerAlgorithm)
+{
+    switch (schedulerAlgorithm)
+    {
+        case 0:
+            return "First Come First Serve";
+        case 1:
+            return "Round Robin";
+        case 2:
+            return "Uniprogrammed";
+        case 3:
+            return "Shortest Job First";
+        case 4:
+            return "Earliest Deadline First";
+        case 5:
+            return "Completely Fair Scheduler";
+        default:
+            return "Unknown";
+    }
+} // End of the get scheduler algorithm name function
+
+/**
+ * Returns the short name of a scheduler algorithm, e.g. "FCFS", as used in the machine readable reports
+ */
+const char* getSchedulerAlgorithmShortName(uint8_t schedulerAlgorithm)
+{
+    switch (schedulerAlgorithm)
+    {
+        case 0:
+            return "FCFS";
+        case 1:
+            return "RR";
+        case 2:
+            return "UNI";
+        case 3:
+            return "SJF";
+        case 4:
+            return "EDF";
+        case 5:
+            return "CFS";
+        default:
+            return "UNKNOWN";
+    }
+} // End of the get scheduler algorithm short name function
+
+/**
+ * Appends a process in the " ( A B C M)" format, or " ( A B C M D)" if it has a deadline, or " ( A B C M D N)" if it
+ * has a niceness
+ */
+static void printProcessInput(struct ReportBuffer* buffer, const struct Process* process)
+{
+    appendString(buffer, " ( ");
+    appendUnsignedInteger(buffer, process->A);
+    appendCharacter(buffer, ' ');
+    appendUnsignedInteger(buffer, process->B);
+    appendCharacter(buffer, ' ');
+    appendUnsignedInteger(buffer, process->C);
+    appendCharacter(buffer, ' ');
+    appendUnsignedInteger(buffer, process->M);
+    if ((process->D != 0) || (process->niceness != 0))
+    {
+        appendCharacter(buffer, ' ');
+        appendUnsignedInteger(buffer, process->D);
+    }
+    if (process->niceness != 0)
+    {
+        appendCharacter(buffer, ' ');
+        appendInteger(buffer, process->niceness);
+    }
+    appendCharacter(buffer, ')');
+} // End of the print process input function
+
+/**
+ * Prints the original input
+ * @param context The simulation, whose processContainer holds the original processes inputted
+ */
+void printStart(struct ReportBuffer* buffer, const struct SchedulerContext* context)
+{
+    appendString(buffer, "The original input was: ");
+    appendUnsignedInteger(buffer, context->totalCreatedProcesses);
+
+    uint32_t i = 0;
+    for (; i < context->totalCreatedProcesses; ++i)
+        printProcessInput(buffer, &context->processContainer[i]);
+    appendCharacter(buffer, '\n');
+} // End of the print start function
+
+/**
+ * Prints the final output
+ * @param context The simulation, whose finishedProcessOrder holds the terminated processes in the order they finished
+ */
+void printFinal(struct ReportBuffer* buffer, const struct SchedulerContext* context)
+{
+    appendString(buffer, "The (sorted) input is: ");
+    appendUnsignedInteger(buffer, context->totalCreatedProcesses);
+
+    uint32_t i = 0;
+    for (; i < context->totalFinishedProcesses; ++i)
+        printProcessInput(buffer, &context->processContainer[context->finishedProcessOrder[i]]);
+    appendCharacter(buffer, '\n');
+} // End of the print final function
+
+/**
+ * Prints out specifics for each process.
+ * @param context The completed simulation
+ */
+void printProcessSpecifics(struct ReportBuffer* buffer, const struct SchedulerContext* context)
+{
+    uint32_t i = 0;
+    appendCharacter(buffer, '\n');
+    for (; i < context->totalCreatedProcesses; ++i)
+    {
+        struct ProcessMetrics metrics;
+        getProcessMetrics(context, i, &metrics);
+        appendString(buffer, "Process ");
+        appendUnsignedInteger(buffer, metrics.processID);
+        if (metrics.niceness != 0)
+            appendString(buffer, ":\n\t(A,B,C,M,D,N) = (");
+        else
+            appendString(buffer, (metrics.D == 0) ? ":\n\t(A,B,C,M) = (" : ":\n\t(A,B,C,M,D) = (");
+        appendUnsignedInteger(buffer, metrics.A);
+        appendCharacter(buffer, ',');
+        appendUnsignedInteger(buffer, metrics.B);
+        appendCharacter(buffer, ',');
+        appendUnsignedInteger(buffer, metrics.C);
+        appendCharacter(buffer, ',');
+        appendUnsignedInteger(buffer, metrics.M);
+        if ((metrics.D != 0) || (metrics.niceness != 0))
+        {
+            appendCharacter(buffer, ',');
+            appendUnsignedInteger(buffer, metrics.D);
+        }
+        if (metrics.niceness != 0)
+        {
+            appendCharacter(buffer, ',');
+            appendInteger(buffer, metrics.niceness);
+        }
+        appendString(buffer, ")\n\tFinishing time: ");
+        appendUnsignedInteger(buffer, metrics.finishingTime);
+        appendString(buffer, "\n\tTurnaround time: ");
+        appendUnsignedInteger(buffer, metrics.turnaroundTime);
+        appendString(buffer, "\n\tI/O time: ");
+        appendUnsignedInteger(buffer, metrics.IOTime);
+        appendString(buffer, "\n\tWaiting time: ");
+        appendUnsignedInteger(buffer, metrics.waitingTime);
+        if (metrics.D != 0)
+        {
+            appendString(buffer, "\n\tLateness: ");
+            appendInteger(buffer, metrics.lateness);
+        }
+        appendString(buffer, "\n\n");
+    }
+} // End of the print process specifics function
+
+/**
+ * Prints out the summary data
+ * @param context The completed simulation
+ */
+void printSummaryData(struct ReportBuffer* buffer, const struct SchedulerContext* context)
+{
+    struct SummaryMetrics metrics;
+    getSummaryMetrics(context, &metrics);
+
+    appendString(buffer, "Summary Data:\n\tFinishing time: ");
+    appendUnsignedInteger(buffer, metrics.finishingTime);
+    appendString(buffer, "\n\tCPU Utilisation: ");
+    appendFixedPoint(buffer, metrics.CPUUtilisation);
+    appendString(buffer, "\n\tI/O Utilisation: ");
+    appendFixedPoint(buffer, metrics.IOUtilisation);
+    appendString(buffer, "\n\tThroughput: ");
+    appendFixedPoint(buffer, metrics.throughput);
+    appendString(buffer, " processes per hundred cycles\n\tAverage turnaround time: ");
+    appendFixedPoint(buffer, metrics.averageTurnaroundTime);
+    appendString(buffer, "\n\tAverage waiting time: ");
+    appendFixedPoint(buffer, metrics.averageWaitingTime);
+    appendCharacter(buffer, '\n');
+
+    // Only mixes with deadlines have the deadline summary
+    if (metrics.totalDeadlineProcesses != 0)
+    {
+        appendString(buffer, "\tDeadline misses: ");
+        appendUnsignedInteger(buffer, metrics.totalDeadlineMisses);
+        appendString(buffer, " of ");
+        appendUnsignedInteger(buffer, metrics.totalDeadlineProcesses);
+        appendString(buffer, "\n\tAverage lateness: ");
+        appendFixedPoint(buffer, metrics.averageLateness);
+        if (metrics.firstMissCycle == -1)
+            appendString(buffer, "\n\tFirst deadline miss: none\n");
+        else
+        {
+            appendString(buffer, "\n\tFirst deadline miss: cycle ");
+            appendInteger(buffer, metrics.firstMissCycle);
+            appendString(buffer, ", at CPU Utilisation ");
+            appendFixedPoint(buffer, metrics.firstMissCPUUtilisation);
+            appendCharacter(buffer, '\n');
+        }
+    }
+} // End of the print summary data function
+
+/**
+ * Prints a single line of the latency percentiles, e.g. "\tWaiting time: p50 1 p90 4 p99 7 p99.9 7 max 7"
+ */
+static void printLatencyLine(struct ReportBuffer* buffer, const char* name, const struct LatencyHistogram* histogram)
+{
+    struct LatencyPercentiles percentiles;
+    getLatencyPercentiles(histogram, &percentiles);
+
+    appendCharacter(buffer, '\t');
+    appendString(buffer, name);
+    appendString(buffer, ": p50 ");
+    appendUnsignedInteger(buffer, percentiles.p50);
+    appendString(buffer, " p90 ");
+    appendUnsignedInteger(buffer, percentiles.p90);
+    appendString(buffer, " p99 ");
+    appendUnsignedInteger(buffer, percentiles.p99);
+    appendString(buffer, " p99.9 ");
+    appendUnsignedInteger(buffer, percentiles.p999);
+    appendString(buffer, " max ");
+    appendUnsignedInteger(buffer, percentiles.maximum);
+    appendCharacter(buffer, '\n');
+} // End of the print latency line function
+
+/**
+ * Prints out the latency percentiles of each of the four latency histograms
+ */
+static void printLatencyHistograms(struct ReportBuffer* buffer, const struct LatencyHistogram* turnaroundHistogram,
+                                   const struct LatencyHistogram* waitingHistogram,
+                                   const struct LatencyHistogram* responseHistogram,
+                                   const struct LatencyHistogram* readyDelayHistogram)
+{
+    appendString(buffer, "Latency Percentiles:\n");
+    printLatencyLine(buffer, "Turnaround time", turnaroundHistogram);
+    printLatencyLine(buffer, "Waiting time", waitingHistogram);
+    printLatencyLine(buffer, "Response time", responseHistogram);
+    printLatencyLine(buffer, "Ready queue delay", readyDelayHistogram);
+} // End of the print latency histograms function
+
+/**
+ * Prints out the latency percentiles
+ * @param context The completed simulation
+ */
+void printLatencyPercentiles(struct ReportBuffer* buffer, const struct SchedulerContext* context)
+{
+    printLatencyHistograms(buffer, &context->turnaroundHistogram, &context->waitingHistogram,
+                           &context->responseHistogram, &context->readyDelayHistogram);
+    if (context->totalDeadlineProcesses != 0)
+        printLatencyLine(buffer, "Deadline lateness", &context->latenessHistogram);
+} // End of the print latency percentiles function
+
+/**
+ * Prints a single line comparing a value with that of round robin, e.g. "\tAverage waiting time: 4.500000 (RR 6.000000)"
+ */
+static void printComparisonLine(struct ReportBuffer* buffer, const char* name, double value, double roundRobinValue)
+{
+    appendCharacter(buffer, '\t');
+    appendString(buffer, name);
+    appendString(buffer, ": ");
+    appendFixedPoint(buffer, value);
+    appendString(buffer, " (RR ");
+    appendFixedPoint(buffer, roundRobinValue);
+    appendString(buffer, ")\n");
+} // End of the print comparison line function
+
+/**
+ * Prints out the fairness and latency of a completed simulation next to those of round robin on the same mix
+ */
+void printRoundRobinComparison(struct ReportBuffer* buffer, const struct SchedulerContext* context,
+                               const struct SummaryMetrics* roundRobinMetrics,
+                               const struct LatencyHistogram* roundRobinResponseHistogram)
+{
+    struct SummaryMetrics metrics;
+    getSummaryMetrics(context, &metrics);
+
+    appendString(buffer, "Compared with Round Robin:\n");
+    printComparisonLine(buffer, "Fairness index", metrics.fairnessIndex, roundRobinMetrics->fairnessIndex);
+    printComparisonLine(buffer, "Average turnaround time", metrics.averageTurnaroundTime,
+                        roundRobinMetrics->averageTurnaroundTime);
+    printComparisonLine(buffer, "Average waiting time", metrics.averageWaitingTime, roundRobinMetrics->averageWaitingTime);
+    printComparisonLine(buffer, "Response time p50", getLatencyPercentile(&context->responseHistogram, 50),
+                        getLatencyPercentile(roundRobinResponseHistogram, 50));
+    printComparisonLine(buffer, "Response time p99", getLatencyPercentile(&context->responseHistogram, 99),
+                        getLatencyPercentile(roundRobinResponseHistogram, 99));
+} // End of the print round robin comparison function
+
+/**
+ * Prints a single line of the replication summary, e.g. "\tCPU Utilisation: 0.845467 +/- 0.012000"
+ */
+static void printMetricEstimate(struct ReportBuffer* buffer, const char* name, const struct MetricEstimate* estimate)
+{
+    appendCharacter(buffer, '\t');
+    appendString(buffer, name);
+    appendString(buffer, ": ");
+    appendFixedPoint(buffer, estimate->mean);
+    appendString(buffer, " +/- ");
+    appendFixedPoint(buffer, estimate->confidenceHalfWidth);
+    appendString(buffer, " (standard deviation ");
+    appendFixedPoint(buffer, estimate->standardDeviation);
+    appendString(buffer, ")\n");
+} // End of the print metric estimate function
+
+/**
+ * Prints out the summary data aggregated over many replications, with 95% confidence intervals
+ */
+void printReplicationSummary(struct ReportBuffer* buffer, const struct ReplicationSummary* summary,
+                             bool isLatencyIncluded)
+{
+    appendString(buffer, "Replication Summary Data (");
+    appendUnsignedInteger(buffer, summary->totalReplications);
+    appendString(buffer, " replications, mean +/- 95% confidence interval):\n");
+    printMetricEstimate(buffer, "Finishing time", &summary->finishingTime);
+    printMetricEstimate(buffer, "CPU Utilisation", &summary->CPUUtilisation);
+    printMetricEstimate(buffer, "I/O Utilisation", &summary->IOUtilisation);
+    printMetricEstimate(buffer, "Throughput", &summary->throughput);
+    printMetricEstimate(buffer, "Average turnaround time", &summary->averageTurnaroundTime);
+    printMetricEstimate(buffer, "Average waiting time", &summary->averageWaitingTime);
+
+    if (isLatencyIncluded)
+        printLatencyHistograms(buffer, &summary->turnaroundHistogram, &summary->waitingHistogram,
+                               &summary->responseHistogram, &summary->readyDelayHistogram);
+} // End of the print replication summary function
+
+/**
+ * Appends a configuration tried by the tuner, e.g. "Round Robin (quantum 4)"
+ */
+static void printTuningConfiguration(struct ReportBuffer* buffer, const struct TuningConfiguration* configuration)
+{
+    appendString(buffer, getSchedulerAlgorithmName(configuration->schedulerAlgorithm));
+    if (configuration->schedulerAlgorithm == 1)
+    {
+        appendString(buffer, " (quantum ");
+        appendInteger(buffer, configuration->parameters.roundRobinQuantum);
+        appendCharacter(buffer, ')');
+    }
+    else if (configuration->schedulerAlgorithm == 5)
+    {
+        appendString(buffer, " (target latency ");
+        appendUnsignedInteger(buffer, configuration->parameters.targetLatency);
+        appendString(buffer, ", minimum granularity ");
+        appendUnsignedInteger(buffer, configuration->parameters.minimumGranularity);
+        appendCharacter(buffer, ')');
+    }
+} // End of the print tuning configuration function
+
+/**
+ * Prints out the best configuration found by the tuner, and the Pareto front between throughput and tail latency
+ */
+void printTuningResult(struct ReportBuffer* buffer, const struct TuningResult* result)
+{
+    static const char* objectiveNames[] = {"minimise the average waiting time", "minimise the average turnaround time",
+                                           "maximise the throughput", "minimise the turnaround time p99"};
+
+    appendString(buffer, "######################### START OF AUTOMATIC TUNING #########################\n");
+    appendString(buffer, "The objective was to ");
+    appendString(buffer, objectiveNames[(result->objective <= 3) ? result->objective : 3]);
+    appendString(buffer, ", over ");
+    appendUnsignedInteger(buffer, result->totalConfigurations);
+    appendString(buffer, " configurations\n");
+
+    const struct TuningConfiguration* best = &result->configurations[result->bestConfiguration];
+    appendString(buffer, "The best configuration was ");
+    printTuningConfiguration(buffer, best);
+    appendString(buffer, "\n\tAverage waiting time: ");
+    appendFixedPoint(buffer, best->averageWaitingTime);
+    appendString(buffer, "\n\tAverage turnaround time: ");
+    appendFixedPoint(buffer, best->averageTurnaroundTime);
+    appendString(buffer, "\n\tThroughput: ");
+    appendFixedPoint(buffer, best->throughput);
+    appendString(buffer, " processes per hundred cycles\n\tTurnaround time p99: ");
+    appendUnsignedInteger(buffer, best->tailLatency);
+
+    // The front is listed from the highest throughput down to the lowest tail latency
+    appendString(buffer, "\n\nPareto Front (throughput against turnaround time p99):\n");
+    double previousThroughput = 0.0;
+    bool hasPrevious = false;
+    while (true)
+    {
+        const struct TuningConfiguration* next = NULL;
+        uint32_t i = 0;
+        for (; i < result->totalConfigurations; ++i)
+        {
+            const struct TuningConfiguration* configuration = &result->configurations[i];
+            if (configuration->isParetoOptimal && (!hasPrevious || (configuration->throughput < previousThroughput))
+                && ((next == NULL) || (configuration->throughput > next->throughput)))
+                next = configuration;
+        }
+        if (next == NULL)
+            break;
+
+        // Lists every configuration with the same results together
+        for (i = 0; i < result->totalConfigurations; ++i)
+        {
+            const struct TuningConfiguration* configuration = &result->configurations[i];
+            if (configuration->isParetoOptimal && (configuration->throughput == next->throughput))
+            {
+                appendCharacter(buffer, '\t');
+                printTuningConfiguration(buffer, configuration);
+                appendString(buffer, ": throughput ");
+                appendFixedPoint(buffer, configuration->throughput);
+                appendString(buffer, ", turnaround time p99 ");
+                appendUnsignedInteger(buffer, configuration->tailLatency);
+                appendCharacter(buffer, '\n');
+            }
+        }
+        previousThroughput = next->throughput;
+        hasPrevious = true;
+    }
+    appendString(buffer, "######################### END OF AUTOMATIC TUNING #########################\n");
+} // End of the print tuning result function
+
+/**
+ * Appends the column names of the CSV per process table
+ */
+void printProcessTableCSVHeader(struct ReportBuffer* buffer)
+{
+    appendString(buffer, "algorithm,process,A,B,C,M,deadline,niceness,finishing_time,turnaround_time,cpu_time,io_time,waiting_time,"
+                         "lateness\n");
+} // End of the print process table CSV header function
+
+/**
+ * Appends one CSV row per process of a completed simulation
+ */
+void printProcessTableCSV(struct ReportBuffer* buffer, const struct SchedulerContext* context)
+{
+    const char* algorithmName = getSchedulerAlgorithmShortName(context->schedulerAlgorithm);
+    uint32_t i = 0;
+    for (; i < context->totalCreatedProcesses; ++i)
+    {
+        struct ProcessMetrics metrics;
+        getProcessMetrics(context, i, &metrics);
+        appendString(buffer, algorithmName);
+        appendCharacter(buffer, ',');
+        appendUnsignedInteger(buffer, metrics.processID);
+        appendCharacter(buffer, ',');
+        appendUnsignedInteger(buffer, metrics.A);
+        appendCharacter(buffer, ',');
+        appendUnsignedInteger(buffer, metrics.B);
+        appendCharacter(buffer, ',');
+        appendUnsignedInteger(buffer, metrics.C);
+        appendCharacter(buffer, ',');
+        appendUnsignedInteger(buffer, metrics.M);
+        appendCharacter(buffer, ',');
+        appendUnsignedInteger(buffer, metrics.D);
+        appendCharacter(buffer, ',');
+        appendInteger(buffer, metrics.niceness);
+        appendCharacter(buffer, ',');
+        appendUnsignedInteger(buffer, metrics.finishingTime);
+        appendCharacter(buffer, ',');
+        appendUnsignedInteger(buffer, metrics.turnaroundTime);
+        appendCharacter(buffer, ',');
+        appendUnsignedInteger(buffer, metrics.CPUTime);
+        appendCharacter(buffer, ',');
+        appendUnsignedInteger(buffer, metrics.IOTime);
+        appendCharacter(buffer, ',');
+        appendUnsignedInteger(buffer, metrics.waitingTime);
+        appendCharacter(buffer, ',');
+        appendInteger(buffer, metrics.lateness);
+        appendCharacter(buffer, '\n');
+    }
+} // End of the print process table CSV function
+
+/**
+ * Appends the column names of the CSV summary table of a sweep over many mixes
+ */
+void printSweepTableCSVHeader(struct ReportBuffer* buffer)
+{
+    appendString(buffer, "algorithm,mix,finishing_time,cpu_utilisation,io_utilisation,throughput,average_turnaround_time,"
+                         "average_waiting_time,deadline_misses\n");
+} // End of the print sweep table CSV header function
+
+/**
+ * Appends one CSV row holding the summary data of a single mix of a sweep, under a single scheduler algorithm
+ */
+void printSweepRowCSV(struct ReportBuffer* buffer, const char* mixName, uint8_t schedulerAlgorithm,
+                      const struct SummaryMetrics* metrics)
+{
+    appendString(buffer, getSchedulerAlgorithmShortName(schedulerAlgorithm));
+    appendCharacter(buffer, ',');
+    appendString(buffer, mixName);
+    appendCharacter(buffer, ',');
+    appendUnsignedInteger(buffer, metrics->finishingTime);
+    appendCharacter(buffer, ',');
+    appendFixedPoint(buffer, metrics->CPUUtilisation);
+    appendCharacter(buffer, ',');
+    appendFixedPoint(buffer, metrics->IOUtilisation);
+    appendCharacter(buffer, ',');
+    appendFixedPoint(buffer, metrics->throughput);
+    appendCharacter(buffer, ',');
+    appendFixedPoint(buffer, metrics->averageTurnaroundTime);
+    appendCharacter(buffer, ',');
+    appendFixedPoint(buffer, metrics->averageWaitingTime);
+    appendCharacter(buffer, ',');
+    appendUnsignedInteger(buffer, metrics->totalDeadlineMisses);
+    appendCharacter(buffer, '\n');
+} // End of the print sweep row CSV function
+
+/**
+ * Appends a "name": value pair of a JSON object
+ */
+static void printJSONInteger(struct ReportBuffer* buffer, const char* name, int64_t value, bool isLast)
+{
+    appendCharacter(buffer, '"');
+    appendString(buffer, name);
+    appendString(buffer, "\": ");
+    appendInteger(buffer, value);
+    if (!isLast)
+        appendString(buffer, ", ");
+} // End of the print JSON integer function
+
+static void printJSONUnsignedInteger(struct ReportBuffer* buffer, const char* name, uint64_t value, bool isLast)
+{
+    appendCharacter(buffer, '"');
+    appendString(buffer, name);
+    appendString(buffer, "\": ");
+    appendUnsignedInteger(buffer, value);
+    if (!isLast)
+        appendString(buffer, ", ");
+} // End of the print JSON unsigned integer function
+
+static void printJSONFixedPoint(struct ReportBuffer* buffer, const char* name, double value, bool isLast)
+{
+    appendCharacter(buffer, '"');
+    appendString(buffer, name);
+    appendString(buffer, "\": ");
+    if (isfinite(value))
+        appendFixedPoint(buffer, value);
+    else
+        appendString(buffer, "null"); // JSON has no representation for infinity or NaN
+    if (!isLast)
+        appendString(buffer, ", ");
+} // End of the print JSON fixed point function
+
+/**
+ * Appends a "name": {percentiles} pair of a JSON object
+ */
+static void printJSONLatency(struct ReportBuffer* buffer, const char* name, const struct LatencyHistogram* histogram,
+                             bool isLast)
+{
+    struct LatencyPercentiles percentiles;
+    getLatencyPercentiles(histogram, &percentiles);
+
+    appendCharacter(buffer, '"');
+    appendString(buffer, name);
+    appendString(buffer, "\": {");
+    printJSONUnsignedInteger(buffer, "count", percentiles.totalCount, false);
+    printJSONFixedPoint(buffer, "mean", percentiles.mean, false);
+    printJSONUnsignedInteger(buffer, "p50", percentiles.p50, false);
+    printJSONUnsignedInteger(buffer, "p90", percentiles.p90, false);
+    printJSONUnsignedInteger(buffer, "p99", percentiles.p99, false);
+    printJSONUnsignedInteger(buffer, "p99.9", percentiles.p999, false);
+    printJSONUnsignedInteger(buffer, "max", percentiles.maximum, true);
+    appendCharacter(buffer, '}');
+    if (!isLast)
+        appendString(buffer, ", ");
+} // End of the print JSON latency function
+
+/**
+ * Appends a JSON object holding the per process table and summary data of a completed simulation
+ */
+void printReportJSON(struct ReportBuffer* buffer, const struct SchedulerContext* context)
+{
+    appendString(buffer, "{\"algorithm\": \"");
+    appendString(buffer, getSchedulerAlgorithmShortName(context->schedulerAlgorithm));
+    appendString(buffer, "\", \"processes\": [");
+
+    uint32_t i = 0;
+    for (; i < context->totalCreatedProcesses; ++i)
+    {
+        struct ProcessMetrics metrics;
+        getProcessMetrics(context, i, &metrics);
+        appendString(buffer, (i == 0) ? "\n  {" : ",\n  {");
+        printJSONUnsignedInteger(buffer, "process", metrics.processID, false);
+        printJSONUnsignedInteger(buffer, "A", metrics.A, false);
+        printJSONUnsignedInteger(buffer, "B", metrics.B, false);
+        printJSONUnsignedInteger(buffer, "C", metrics.C, false);
+        printJSONUnsignedInteger(buffer, "M", metrics.M, false);
+        printJSONUnsignedInteger(buffer, "D", metrics.D, false);
+        printJSONInteger(buffer, "N", metrics.niceness, false);
+        printJSONUnsignedInteger(buffer, "finishing_time", metrics.finishingTime, false);
+        printJSONUnsignedInteger(buffer, "turnaround_time", metrics.turnaroundTime, false);
+        printJSONUnsignedInteger(buffer, "cpu_time", metrics.CPUTime, false);
+        printJSONUnsignedInteger(buffer, "io_time", metrics.IOTime, false);
+        printJSONUnsignedInteger(buffer, "waiting_time", metrics.waitingTime, false);
+        printJSONInteger(buffer, "lateness", metrics.lateness, true);
+        appendCharacter(buffer, '}');
+    }
+
+    struct SummaryMetrics summary;
+    getSummaryMetrics(context, &summary);
+    appendString(buffer, "],\n \"summary\": {");
+    printJSONUnsignedInteger(buffer, "finishing_time", summary.finishingTime, false);
+    printJSONFixedPoint(buffer, "cpu_utilisation", summary.CPUUtilisation, false);
+    printJSONFixedPoint(buffer, "io_utilisation", summary.IOUtilisation, false);
+    printJSONFixedPoint(buffer, "throughput", summary.throughput, false);
+    printJSONFixedPoint(buffer, "average_turnaround_time", summary.averageTurnaroundTime, false);
+    printJSONFixedPoint(buffer, "average_waiting_time", summary.averageWaitingTime, false);
+    printJSONFixedPoint(buffer, "fairness_index", summary.fairnessIndex, false);
+    printJSONUnsignedInteger(buffer, "deadline_processes", summary.totalDeadlineProcesses, false);
+    printJSONUnsignedInteger(buffer, "deadline_misses", summary.totalDeadlineMisses, false);
+    printJSONFixedPoint(buffer, "average_lateness", summary.averageLateness, false);
+    printJSONInteger(buffer, "first_miss_cycle", summary.firstMissCycle, false);
+    printJSONFixedPoint(buffer, "first_miss_cpu_utilisation", summary.firstMissCPUUtilisation, true);
+    appendString(buffer, "},\n \"latency\": {");
+    printJSONLatency(buffer, "turnaround_time", &context->turnaroundHistogram, false);
+    printJSONLatency(buffer, "waiting_time", &context->waitingHistogram, false);
+    printJSONLatency(buffer, "response_time", &context->responseHistogram, false);
+    printJSONLatency(buffer, "ready_queue_delay", &context->readyDelayHistogram, false);
+    printJSONLatency(buffer, "deadline_lateness", &context->latenessHistogram, true);
+    appendString(buffer, "}}");
+} // End of the print report JSON function
+
+/************************ END OF REPORT SECTION FUNCTIONS *************************************/
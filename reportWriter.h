@@ -0,0 +1,115 @@
+#ifndef REPORT_WRITER_H
+#define REPORT_WRITER_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "libscheduler.h"
+#include "monteCarlo.h"
+#include "autoTuner.h"
+
+/* A growable output buffer, so that a whole report goes out in a single write */
+struct ReportBuffer {
+    char* data;                         // The report text so far (not NUL terminated)
+    size_t length;                      // The number of bytes used in data
+    size_t capacity;                    // The number of bytes allocated for data
+};
+
+void initialiseReportBuffer(struct ReportBuffer* buffer);
+void freeReportBuffer(struct ReportBuffer* buffer);
+
+/**
+ * Writes out everything in the buffer with a single write, and empties it
+ */
+void flushReportBuffer(struct ReportBuffer* buffer, FILE* outputFile);
+
+void appendString(struct ReportBuffer* buffer, const char* string);
+void appendCharacter(struct ReportBuffer* buffer, char character);
+
+/**
+ * Appends a signed integer, formatted identically to printf("%lli")
+ */
+void appendInteger(struct ReportBuffer* buffer, int64_t value);
+
+/**
+ * Appends an unsigned integer, formatted identically to printf("%llu")
+ */
+void appendUnsignedInteger(struct ReportBuffer* buffer, uint64_t value);
+
+/**
+ * Appends a real number with 6 decimal places, formatted identically to printf("%6f")
+ */
+void appendFixedPoint(struct ReportBuffer* buffer, double value);
+
+/**
+ * Returns the name of a scheduler algorithm, e.g. "First Come First Serve"
+ */
+const char* getSchedulerAlgorithmName(uint8_t schedulerAlgorithm);
+
+/**
+ * Returns the short name of a scheduler algorithm, e.g. "FCFS", as used in the machine readable reports
+ */
+const char* getSchedulerAlgorithmShortName(uint8_t schedulerAlgorithm);
+
+/* The sections of the default text report */
+void printStart(struct ReportBuffer* buffer, const struct SchedulerContext* context);
+void printFinal(struct ReportBuffer* buffer, const struct SchedulerContext* context);
+void printProcessSpecifics(struct ReportBuffer* buffer, const struct SchedulerContext* context);
+void printSummaryData(struct ReportBuffer* buffer, const struct SchedulerContext* context);
+
+/**
+ * Appends the p50, p90, p99, p99.9 and maximum of the turnaround, waiting, response and ready queue delay times
+ */
+void printLatencyPercentiles(struct ReportBuffer* buffer, const struct SchedulerContext* context);
+
+/**
+ * Appends the fairness index, turnaround, waiting and response times of a completed simulation, each next to that of
+ * round robin on the same mix
+ * @param roundRobinMetrics The summary data of round robin
+ * @param roundRobinResponseHistogram The response times of round robin
+ */
+void printRoundRobinComparison(struct ReportBuffer* buffer, const struct SchedulerContext* context,
+                               const struct SummaryMetrics* roundRobinMetrics,
+                               const struct LatencyHistogram* roundRobinResponseHistogram);
+
+/**
+ * Appends the best configuration found by the tuner, and every configuration on the Pareto front between throughput
+ * and tail latency
+ */
+void printTuningResult(struct ReportBuffer* buffer, const struct TuningResult* result);
+
+/**
+ * Appends the summary data aggregated over many replications, with 95% confidence intervals
+ * @param isLatencyIncluded Whether to follow it with the latency percentiles of every replication merged together
+ */
+void printReplicationSummary(struct ReportBuffer* buffer, const struct ReplicationSummary* summary,
+                             bool isLatencyIncluded);
+
+/**
+ * Appends the column names of the CSV per process table
+ */
+void printProcessTableCSVHeader(struct ReportBuffer* buffer);
+
+/**
+ * Appends one CSV row per process of a completed simulation
+ */
+void printProcessTableCSV(struct ReportBuffer* buffer, const struct SchedulerContext* context);
+
+/**
+ * Appends the column names of the CSV summary table of a sweep over many mixes
+ */
+void printSweepTableCSVHeader(struct ReportBuffer* buffer);
+
+/**
+ * Appends one CSV row holding the summary data of a single mix of a sweep, under a single scheduler algorithm
+ * @param mixName The name the mix is given in the table, e.g. its file name
+ */
+void printSweepRowCSV(struct ReportBuffer* buffer, const char* mixName, uint8_t schedulerAlgorithm,
+                      const struct SummaryMetrics* metrics);
+
+/**
+ * Appends a JSON object holding the per process table, summary data and latencies of a completed simulation
+ */
+void printReportJSON(struct ReportBuffer* buffer, const struct SchedulerContext* context);
+
+#endif // REPORT_WRITER_H
@@ -0,0 +1,398 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "resultCache.h"
+
+#define RUN_KEY_HEADER_LENGTH 8         // The number of values identifying a run before those of its processes
+#define PROCESS_KEY_LENGTH 6            // The number of values identifying each process (A, B, C, M, D and N)
+#define PROCESS_RESULT_LENGTH 6         // The number of values of each process's results
+
+/************************ START OF KEY FUNCTIONS *************************************/
+
+/**
+ * Adds a value to an FNV-1a hash, a byte at a time
+ */
+static uint64_t hashValue(uint64_t hash, uint64_t value)
+{
+    uint8_t i = 0;
+    for (; i < 8; ++i)
+    {
+        hash ^= (value >> (8 * i)) & 0xff;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+} // End of the hash value function
+
+/**
+ * Fills in the values identifying a run, other than its processes. The parameters are only included for the scheduler
+ * algorithm that uses them, so that e.g. FCFS results are shared between runs with different quanta.
+ */
+static void getRunKeyHeader(const struct ResultCache* cache, const struct SchedulerContext* context,
+                            uint64_t header[RUN_KEY_HEADER_LENGTH])
+{
+    header[0] = SCHEDULER_ENGINE_VERSION;
+    header[1] = context->schedulerAlgorithm;
+    header[2] = (context->schedulerAlgorithm == 1) ? (uint64_t) (int64_t) context->parameters.roundRobinQuantum : 0;
+    header[3] = (context->schedulerAlgorithm == 5) ? context->parameters.targetLatency : 0;
+    header[4] = (context->schedulerAlgorithm == 5) ? context->parameters.minimumGranularity : 0;
+    header[5] = cache->randomSourceDigest;
+    header[6] = context->randomNumberOffset;
+    header[7] = context->totalCreatedProcesses;
+} // End of the get run key header function
+
+/**
+ * Fills in the values identifying a single process of a run
+ */
+static void getProcessKey(const struct Process* process, uint64_t key[PROCESS_KEY_LENGTH])
+{
+    key[0] = process->A;
+    key[1] = process->B;
+    key[2] = process->C;
+    key[3] = process->M;
+    key[4] = process->D;
+    key[5] = (uint64_t) (int64_t) process->niceness;
+} // End of the get process key function
+
+/**
+ * Hashes every value identifying a run, naming its cache file
+ */
+static uint64_t hashRunKey(const struct ResultCache* cache, const struct SchedulerContext* context)
+{
+    uint64_t header[RUN_KEY_HEADER_LENGTH];
+    getRunKeyHeader(cache, context, header);
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    uint32_t i = 0;
+    for (; i < RUN_KEY_HEADER_LENGTH; ++i)
+        hash = hashValue(hash, header[i]);
+
+    for (i = 0; i < context->totalCreatedProcesses; ++i)
+    {
+        uint64_t key[PROCESS_KEY_LENGTH];
+        getProcessKey(&context->processContainer[i], key);
+        uint8_t j = 0;
+        for (; j < PROCESS_KEY_LENGTH; ++j)
+            hash = hashValue(hash, key[j]);
+    }
+    return hash;
+} // End of the hash run key function
+
+/**
+ * Builds the path of a file in the cache directory, e.g. "cache/0123456789abcdef.result"
+ * @param suffix Follows the hash, e.g. ".result"
+ * @return The newly allocated path, to be released with free(), or NULL if out of memory
+ */
+static char* getCachePath(const struct ResultCache* cache, uint64_t hash, const char* suffix)
+{
+    size_t length = strlen(cache->directory) + strlen(suffix) + 19;
+    char* path = malloc(length);
+    if (path != NULL)
+        snprintf(path, length, "%s/%016" PRIx64 "%s", cache->directory, hash, suffix);
+    return path;
+} // End of the get cache path function
+
+/************************ END OF KEY FUNCTIONS *************************************/
+
+/************************ START OF FILE FUNCTIONS *************************************/
+
+/**
+ * Writes a single value, in the byte order of this machine (a cache is not meant to be moved between machines)
+ */
+static void writeValue(FILE* cacheFile, uint64_t value)
+{
+    fwrite(&value, sizeof(uint64_t), 1, cacheFile);
+} // End of the write value function
+
+static bool readValue(FILE* cacheFile, uint64_t* value)
+{
+    return fread(value, sizeof(uint64_t), 1, cacheFile) == 1;
+} // End of the read value function
+
+/**
+ * Writes a latency histogram, with only the buckets that have been counted in
+ */
+static void writeHistogram(FILE* cacheFile, const struct LatencyHistogram* histogram)
+{
+    uint64_t total;
+    memcpy(&total, &histogram->total, sizeof(uint64_t));
+    writeValue(cacheFile, histogram->totalCount);
+    writeValue(cacheFile, histogram->minimum);
+    writeValue(cacheFile, histogram->maximum);
+    writeValue(cacheFile, total);
+
+    uint64_t totalBuckets = 0;
+    uint32_t i = 0;
+    for (; i < LATENCY_HISTOGRAM_BUCKET_COUNT; ++i)
+        totalBuckets += histogram->counts[i] != 0;
+    writeValue(cacheFile, totalBuckets);
+    for (i = 0; i < LATENCY_HISTOGRAM_BUCKET_COUNT; ++i)
+    {
+        if (histogram->counts[i] != 0)
+        {
+            writeValue(cacheFile, i);
+            writeValue(cacheFile, histogram->counts[i]);
+        }
+    }
+} // End of the write histogram function
+
+/**
+ * Reads a latency histogram written by writeHistogram()
+ * @return false if the file is cut short or malformed
+ */
+static bool readHistogram(FILE* cacheFile, struct LatencyHistogram* histogram)
+{
+    uint64_t total;
+    uint64_t totalBuckets;
+    resetLatencyHistogram(histogram);
+    if (!readValue(cacheFile, &histogram->totalCount) || !readValue(cacheFile, &histogram->minimum)
+        || !readValue(cacheFile, &histogram->maximum) || !readValue(cacheFile, &total)
+        || !readValue(cacheFile, &totalBuckets) || (totalBuckets > LATENCY_HISTOGRAM_BUCKET_COUNT))
+        return false;
+    memcpy(&histogram->total, &total, sizeof(double));
+
+    uint64_t i = 0;
+    for (; i < totalBuckets; ++i)
+    {
+        uint64_t bucket;
+        if (!readValue(cacheFile, &bucket) || (bucket >= LATENCY_HISTOGRAM_BUCKET_COUNT)
+            || !readValue(cacheFile, &histogram->counts[bucket]))
+            return false;
+    }
+    return true;
+} // End of the read histogram function
+
+/**
+ * Reads the values identifying a run from a cache file, checking that they are those of the context's run
+ * @return false if they are not, or the file is cut short
+ */
+static bool readRunKey(FILE* cacheFile, const struct ResultCache* cache, const struct SchedulerContext* context)
+{
+    char magic[4];
+    if ((fread(magic, 1, 4, cacheFile) != 4) || (memcmp(magic, RESULT_CACHE_MAGIC, 4) != 0))
+        return false;
+
+    uint64_t header[RUN_KEY_HEADER_LENGTH];
+    getRunKeyHeader(cache, context, header);
+    uint64_t value;
+    uint32_t i = 0;
+    for (; i < RUN_KEY_HEADER_LENGTH; ++i)
+    {
+        if (!readValue(cacheFile, &value) || (value != header[i]))
+            return false;
+    }
+
+    for (i = 0; i < context->totalCreatedProcesses; ++i)
+    {
+        uint64_t key[PROCESS_KEY_LENGTH];
+        getProcessKey(&context->processContainer[i], key);
+        uint8_t j = 0;
+        for (; j < PROCESS_KEY_LENGTH; ++j)
+        {
+            if (!readValue(cacheFile, &value) || (value != key[j]))
+                return false;
+        }
+    }
+    return true;
+} // End of the read run key function
+
+/**
+ * Reads the results of a run into the context, after its key
+ * @return false if the file is cut short or malformed
+ */
+static bool readRunResults(FILE* cacheFile, struct SchedulerContext* context)
+{
+    uint64_t values[6];
+    uint32_t i = 0;
+    for (; i < 6; ++i)
+    {
+        if (!readValue(cacheFile, &values[i]))
+            return false;
+    }
+    if (values[1] > context->totalCreatedProcesses)
+        return false;
+    context->currentCycle = values[0];
+    context->totalFinishedProcesses = (uint32_t) values[1];
+    context->totalNumberOfCyclesSpentBlocked = values[2];
+    context->randomNumberIndex = (uint32_t) values[3];
+    context->firstMissCycle = (int64_t) values[4];
+    context->CPUTimeBeforeFirstMiss = values[5];
+    context->totalStartedProcesses = context->totalCreatedProcesses;
+
+    for (i = 0; i < context->totalCreatedProcesses; ++i)
+    {
+        struct Process* process = &context->processContainer[i];
+        uint64_t results[PROCESS_RESULT_LENGTH];
+        uint8_t j = 0;
+        for (; j < PROCESS_RESULT_LENGTH; ++j)
+        {
+            if (!readValue(cacheFile, &results[j]))
+                return false;
+        }
+        process->status = 4;
+        process->finishingTime = results[0];
+        process->currentCPUTimeRun = results[1];
+        process->currentIOBlockedTime = results[2];
+        process->currentWaitingTime = results[3];
+        process->firstDispatchCycle = (int64_t) results[4];
+        process->totalCPUBursts = results[5];
+    }
+
+    for (i = 0; i < context->totalFinishedProcesses; ++i)
+    {
+        uint64_t processID;
+        if (!readValue(cacheFile, &processID) || (processID >= context->totalCreatedProcesses))
+            return false;
+        context->finishedProcessOrder[i] = (uint32_t) processID;
+    }
+
+    return readHistogram(cacheFile, &context->turnaroundHistogram)
+           && readHistogram(cacheFile, &context->waitingHistogram)
+           && readHistogram(cacheFile, &context->responseHistogram)
+           && readHistogram(cacheFile, &context->readyDelayHistogram)
+           && readHistogram(cacheFile, &context->latenessHistogram);
+} // End of the read run results function
+
+/************************ END OF FILE FUNCTIONS *************************************/
+
+/************************ START OF CACHE FUNCTIONS *************************************/
+
+/**
+ * Opens a cache directory, creating it if it does not exist
+ */
+bool openResultCache(struct ResultCache* cache, const char* directory, const struct RandomNumberSource* randomSource)
+{
+    struct stat directoryStatus;
+    if ((mkdir(directory, 0777) != 0) && (errno != EEXIST))
+        return false;
+    if ((stat(directory, &directoryStatus) != 0) || !S_ISDIR(directoryStatus.st_mode))
+        return false;
+
+    cache->directory = directory;
+    cache->randomSource = randomSource;
+
+    // Digests the random numbers once, rather than for every run
+    uint64_t digest = 0xcbf29ce484222325ULL;
+    digest = hashValue(digest, randomSource->isCounterBased);
+    if (randomSource->isCounterBased)
+        digest = hashValue(digest, randomSource->seed);
+    else
+    {
+        digest = hashValue(digest, randomSource->totalRandomNumbers);
+        uint32_t i = 0;
+        for (; i < randomSource->totalRandomNumbers; ++i)
+            digest = hashValue(digest, randomSource->randomNumbers[i]);
+    }
+    cache->randomSourceDigest = digest;
+    return true;
+} // End of the open result cache function
+
+/**
+ * Restores the results of a run from the cache into a context that has not been run yet
+ */
+bool loadCachedResults(const struct ResultCache* cache, struct SchedulerContext* context)
+{
+    // An online run's processes are only known once it has been run, and a replayed trace is not part of the key
+    if ((context->submissionQueue != NULL) || (context->burstTrace != NULL)
+        || (context->randomSource != cache->randomSource) || (context->failure != 0))
+        return false;
+
+    char* path = getCachePath(cache, hashRunKey(cache, context), ".result");
+    if (path == NULL)
+        return false;
+    FILE* cacheFile = fopen(path, "rb");
+    free(path);
+    if (cacheFile == NULL)
+        return false;
+
+    bool isLoaded = false;
+    if (readRunKey(cacheFile, cache, context))
+    {
+        isLoaded = readRunResults(cacheFile, context);
+        // A file cut short leaves the context part restored, so puts it back as it was
+        if (!isLoaded)
+            resetSchedulerContext(context);
+    }
+    fclose(cacheFile);
+    return isLoaded;
+} // End of the load cached results function
+
+/**
+ * Adds the results of a completed run to the cache
+ */
+bool storeCachedResults(const struct ResultCache* cache, const struct SchedulerContext* context)
+{
+    if ((context->submissionQueue != NULL) || (context->burstTrace != NULL)
+        || (context->randomSource != cache->randomSource) || (context->failure != 0))
+        return false;
+
+    uint64_t hash = hashRunKey(cache, context);
+    char* path = getCachePath(cache, hash, ".result");
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%ld.tmp", (long) getpid());
+    char* temporaryPath = getCachePath(cache, hash, suffix);
+    FILE* cacheFile = ((path != NULL) && (temporaryPath != NULL)) ? fopen(temporaryPath, "wb") : NULL;
+    if (cacheFile == NULL)
+    {
+        free(path);
+        free(temporaryPath);
+        return false;
+    }
+
+    // The key, in full
+    fwrite(RESULT_CACHE_MAGIC, 1, 4, cacheFile);
+    uint64_t header[RUN_KEY_HEADER_LENGTH];
+    getRunKeyHeader(cache, context, header);
+    uint32_t i = 0;
+    for (; i < RUN_KEY_HEADER_LENGTH; ++i)
+        writeValue(cacheFile, header[i]);
+    for (i = 0; i < context->totalCreatedProcesses; ++i)
+    {
+        uint64_t key[PROCESS_KEY_LENGTH];
+        getProcessKey(&context->processContainer[i], key);
+        uint8_t j = 0;
+        for (; j < PROCESS_KEY_LENGTH; ++j)
+            writeValue(cacheFile, key[j]);
+    }
+
+    // Then the results
+    writeValue(cacheFile, context->currentCycle);
+    writeValue(cacheFile, context->totalFinishedProcesses);
+    writeValue(cacheFile, context->totalNumberOfCyclesSpentBlocked);
+    writeValue(cacheFile, context->randomNumberIndex);
+    writeValue(cacheFile, (uint64_t) context->firstMissCycle);
+    writeValue(cacheFile, context->CPUTimeBeforeFirstMiss);
+    for (i = 0; i < context->totalCreatedProcesses; ++i)
+    {
+        const struct Process* process = &context->processContainer[i];
+        writeValue(cacheFile, process->finishingTime);
+        writeValue(cacheFile, process->currentCPUTimeRun);
+        writeValue(cacheFile, process->currentIOBlockedTime);
+        writeValue(cacheFile, process->currentWaitingTime);
+        writeValue(cacheFile, (uint64_t) process->firstDispatchCycle);
+        writeValue(cacheFile, process->totalCPUBursts);
+    }
+    for (i = 0; i < context->totalFinishedProcesses; ++i)
+        writeValue(cacheFile, context->finishedProcessOrder[i]);
+    writeHistogram(cacheFile, &context->turnaroundHistogram);
+    writeHistogram(cacheFile, &context->waitingHistogram);
+    writeHistogram(cacheFile, &context->responseHistogram);
+    writeHistogram(cacheFile, &context->readyDelayHistogram);
+    writeHistogram(cacheFile, &context->latenessHistogram);
+
+    // Only a completely written file is renamed into place, replacing any older copy
+    bool isWritten = !ferror(cacheFile);
+    isWritten = (fclose(cacheFile) == 0) && isWritten;
+    isWritten = isWritten && (rename(temporaryPath, path) == 0);
+    if (!isWritten)
+        remove(temporaryPath);
+
+    free(path);
+    free(temporaryPath);
+    return isWritten;
+} // End of the store cached results function
+
+/************************ END OF CACHE FUNCTIONS *************************************/
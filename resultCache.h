@@ -0,0 +1,47 @@
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+#include <stdint.h>
+
+#include "libscheduler.h"
+
+/*
+ * Keeps the results of completed runs on disk, one file per run, so that a run repeated with the same workload,
+ * scheduler algorithm, parameters and random numbers is restored instead of simulated again. Each file is named after a
+ * hash of all of those and SCHEDULER_ENGINE_VERSION, and holds them in full as well, so that a hash collision or a file
+ * written by another engine version is treated as a miss. Files are written under a temporary name and then renamed,
+ * so that runs sharing a directory never see a partly written file.
+ */
+
+#define RESULT_CACHE_MAGIC "SRC1"       // The first 4 bytes of every cache file
+
+/* An open cache directory, tied to the random numbers of the contexts it is used with */
+struct ResultCache {
+    const char* directory;
+    const struct RandomNumberSource* randomSource;
+    uint64_t randomSourceDigest;        // A hash of every random number (or of the seed, when counter based)
+};
+
+/**
+ * Opens a cache directory, creating it if it does not exist
+ * @param directory The path of the directory, which must outlive the cache
+ * @param randomSource The random numbers of every context the cache is used with
+ * @return false if the directory could not be created
+ */
+bool openResultCache(struct ResultCache* cache, const char* directory, const struct RandomNumberSource* randomSource);
+
+/**
+ * Restores the results of a run from the cache into a context that has not been run yet, leaving it as if it had been
+ * run to completion as far as getProcessMetrics(), getSummaryMetrics() and the latency histograms are concerned
+ * @return false if the run is not in the cache (the context is then left untouched)
+ */
+bool loadCachedResults(const struct ResultCache* cache, struct SchedulerContext* context);
+
+/**
+ * Adds the results of a completed run to the cache
+ * @return false if the run failed or cannot be cached (an online run, or one replaying a trace), or if the cache file
+ * could not be written
+ */
+bool storeCachedResults(const struct ResultCache* cache, const struct SchedulerContext* context);
+
+#endif // RESULT_CACHE_H
@@ -0,0 +1,233 @@
+#include <stdlib.h>
+#include <sched.h>
+
+#include "submissionQueue.h"
+
+/**
+ * Sets up an empty queue
+ */
+bool initialiseSubmissionQueue(struct SubmissionQueue* queue, uint32_t totalProducers)
+{
+    queue->producers = calloc(totalProducers + 1, sizeof(struct SubmissionProducer));
+    if (queue->producers == NULL)
+        return false;
+    queue->totalProducers = totalProducers;
+    atomic_init(&queue->head, NULL);
+
+    uint32_t i = 0;
+    for (; i < totalProducers; ++i)
+    {
+        atomic_init(&queue->producers[i].watermark, 0);
+        queue->producers[i].totalSubmissions = 0;
+    }
+
+    queue->pendingHeap = NULL;
+    queue->totalPending = 0;
+    queue->pendingCapacity = 0;
+    return true;
+} // End of the initialise submission queue function
+
+/**
+ * Releases a queue, and any submissions still in it, once no thread is using it
+ */
+void freeSubmissionQueue(struct SubmissionQueue* queue)
+{
+    struct Submission* submission = atomic_load(&queue->head);
+    while (submission != NULL)
+    {
+        struct Submission* next = submission->next;
+        free(submission);
+        submission = next;
+    }
+    uint32_t i = 0;
+    for (; i < queue->totalPending; ++i)
+        free(queue->pendingHeap[i]);
+
+    free(queue->pendingHeap);
+    free(queue->producers);
+    queue->pendingHeap = NULL;
+    queue->producers = NULL;
+    queue->totalPending = 0;
+    queue->totalProducers = 0;
+} // End of the free submission queue function
+
+/************************ START OF PRODUCER FUNCTIONS *************************************/
+
+/**
+ * Submits a process, arriving at cycle process->A, which also moves the producer's watermark up to it
+ */
+bool submitProcess(struct SubmissionQueue* queue, uint32_t producerID, const struct ProcessSpecification* process)
+{
+    struct SubmissionProducer* producer = &queue->producers[producerID];
+    if (process->A < atomic_load_explicit(&producer->watermark, memory_order_relaxed))
+        return false;
+
+    struct Submission* submission = malloc(sizeof(struct Submission));
+    if (submission == NULL)
+        return false;
+    submission->specification = *process;
+    submission->producerID = producerID;
+    submission->sequence = producer->totalSubmissions++;
+
+    // Pushes onto the stack, retrying whenever another producer got there first
+    submission->next = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    while (!atomic_compare_exchange_weak_explicit(&queue->head, &submission->next, submission,
+                                                  memory_order_release, memory_order_relaxed));
+
+    // Only published after the push, so the simulation sees the submission before it sees the new watermark
+    atomic_store_explicit(&producer->watermark, process->A, memory_order_release);
+    return true;
+} // End of the submit process function
+
+/**
+ * Promises that the producer will submit nothing arriving before a cycle, letting the simulation run up to it
+ */
+void advanceSubmissionWatermark(struct SubmissionQueue* queue, uint32_t producerID, uint64_t cycle)
+{
+    struct SubmissionProducer* producer = &queue->producers[producerID];
+    if (cycle > atomic_load_explicit(&producer->watermark, memory_order_relaxed))
+        atomic_store_explicit(&producer->watermark, cycle, memory_order_release);
+} // End of the advance submission watermark function
+
+/**
+ * Promises that the producer will submit nothing more
+ */
+void closeSubmissionProducer(struct SubmissionQueue* queue, uint32_t producerID)
+{
+    atomic_store_explicit(&queue->producers[producerID].watermark, UINT64_MAX, memory_order_release);
+} // End of the close submission producer function
+
+/************************ END OF PRODUCER FUNCTIONS *************************************/
+
+/************************ START OF SIMULATION FUNCTIONS *************************************/
+
+/**
+ * Checks whether one submission should be admitted before another: by arrival time, then producer, then submission order
+ */
+static bool isEarlierSubmission(const struct Submission* first, const struct Submission* second)
+{
+    if (first->specification.A != second->specification.A)
+        return first->specification.A < second->specification.A;
+    if (first->producerID != second->producerID)
+        return first->producerID < second->producerID;
+    return first->sequence < second->sequence;
+} // End of the is earlier submission function
+
+/**
+ * Retrieves the lowest watermark of every producer, before which every process has been submitted
+ */
+uint64_t getSubmissionWatermark(struct SubmissionQueue* queue)
+{
+    uint64_t watermark = UINT64_MAX;
+    uint32_t i = 0;
+    for (; i < queue->totalProducers; ++i)
+    {
+        uint64_t producerWatermark = atomic_load_explicit(&queue->producers[i].watermark, memory_order_acquire);
+        if (producerWatermark < watermark)
+            watermark = producerWatermark;
+    }
+    return watermark;
+} // End of the get submission watermark function
+
+/**
+ * Takes every submission off the stack, ready to be admitted in order
+ */
+bool collectSubmissions(struct SubmissionQueue* queue)
+{
+    struct Submission* submission = atomic_exchange_explicit(&queue->head, NULL, memory_order_acquire);
+    while (submission != NULL)
+    {
+        struct Submission* next = submission->next;
+        if (queue->totalPending == queue->pendingCapacity)
+        {
+            // Out of room, doubles the capacity
+            uint32_t capacity = (queue->pendingCapacity == 0) ? 64 : queue->pendingCapacity * 2;
+            struct Submission** grownHeap = realloc(queue->pendingHeap, capacity * sizeof(struct Submission*));
+            if (grownHeap == NULL)
+            {
+                // Puts the rest back, so that nothing is lost
+                while (submission != NULL)
+                {
+                    next = submission->next;
+                    submission->next = atomic_load_explicit(&queue->head, memory_order_relaxed);
+                    while (!atomic_compare_exchange_weak_explicit(&queue->head, &submission->next, submission,
+                                                                  memory_order_release, memory_order_relaxed));
+                    submission = next;
+                }
+                return false;
+            }
+            queue->pendingHeap = grownHeap;
+            queue->pendingCapacity = capacity;
+        }
+
+        // Sifts up past any submission to be admitted after it
+        struct Submission** heap = queue->pendingHeap;
+        uint32_t i = queue->totalPending++;
+        while ((i != 0) && isEarlierSubmission(submission, heap[(i - 1) / 2]))
+        {
+            heap[i] = heap[(i - 1) / 2];
+            i = (i - 1) / 2;
+        }
+        heap[i] = submission;
+        submission = next;
+    }
+    return true;
+} // End of the collect submissions function
+
+/**
+ * Waits until every process arriving on or before a cycle has been submitted, then collects them
+ */
+bool waitForSubmissions(struct SubmissionQueue* queue, uint64_t cycle)
+{
+    while (getSubmissionWatermark(queue) <= cycle)
+        sched_yield();
+    return collectSubmissions(queue);
+} // End of the wait for submissions function
+
+/**
+ * Retrieves the collected submission to be admitted next, without removing it (NULL if there is none)
+ */
+const struct Submission* peekSubmission(const struct SubmissionQueue* queue)
+{
+    return (queue->totalPending == 0) ? NULL : queue->pendingHeap[0];
+} // End of the peek submission function
+
+/**
+ * Removes the collected submission to be admitted next
+ */
+void popSubmission(struct SubmissionQueue* queue, struct ProcessSpecification* process)
+{
+    struct Submission** heap = queue->pendingHeap;
+    struct Submission* earliestSubmission = heap[0];
+    struct Submission* lastSubmission = heap[--queue->totalPending];
+
+    // Sifts the last submission down from the root, into the gap left behind
+    uint32_t i = 0;
+    uint32_t size = queue->totalPending;
+    while (2 * i + 1 < size)
+    {
+        uint32_t child = 2 * i + 1;
+        if ((child + 1 < size) && isEarlierSubmission(heap[child + 1], heap[child]))
+            ++child;
+        if (!isEarlierSubmission(heap[child], lastSubmission))
+            break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = lastSubmission;
+
+    *process = earliestSubmission->specification;
+    free(earliestSubmission);
+} // End of the pop submission function
+
+/**
+ * Checks whether every producer has been closed, and every submission admitted
+ */
+bool isSubmissionQueueFinished(struct SubmissionQueue* queue)
+{
+    // The watermarks are read first, as every submission is pushed before its producer is closed
+    return (getSubmissionWatermark(queue) == UINT64_MAX)
+           && (atomic_load_explicit(&queue->head, memory_order_acquire) == NULL) && (queue->totalPending == 0);
+} // End of the is submission queue finished function
+
+/************************ END OF SIMULATION FUNCTIONS *************************************/
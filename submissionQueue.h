@@ -0,0 +1,105 @@
+#ifndef SUBMISSION_QUEUE_H
+#define SUBMISSION_QUEUE_H
+
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "libscheduler.h"
+
+/*
+ * Carries processes from any number of producer threads to a simulation while it runs (see
+ * createOnlineSchedulerContext()). Producers push onto a lock-free stack, which the simulation thread takes all of with
+ * a single exchange at each step. Each producer also has a watermark: a promise that it will submit nothing arriving
+ * before that cycle. A cycle is only simulated once every producer's watermark is past it, and the processes arriving on
+ * it are admitted in order of producer, then the order each producer submitted them in, so that a run is the same
+ * however the threads happen to be interleaved.
+ */
+
+/* A single submitted process, waiting to be admitted */
+struct Submission {
+    struct ProcessSpecification specification;
+    uint32_t producerID;
+    uint64_t sequence;                  // The number of processes the producer submitted before this one
+    struct Submission* next;            // The submission below this one on the stack
+};
+
+/* The state of a single producer */
+struct SubmissionProducer {
+    _Atomic uint64_t watermark;         // Every later submission arrives on or after this cycle (UINT64_MAX once closed)
+    uint64_t totalSubmissions;          // Only touched by the producer itself
+};
+
+/* A multiple producer, single consumer queue of processes */
+struct SubmissionQueue {
+    _Atomic(struct Submission*) head;   // The top of the stack of submissions not yet taken by the simulation
+    struct SubmissionProducer* producers;
+    uint32_t totalProducers;
+
+    // Only touched by the simulation thread
+    struct Submission** pendingHeap;    // Submissions taken off the stack but not yet admitted, earliest first
+    uint32_t totalPending;
+    uint32_t pendingCapacity;
+};
+
+/**
+ * Sets up an empty queue
+ * @param totalProducers The number of producers, each of which submits with its own producerID from 0 upwards
+ * @return false if out of memory
+ */
+bool initialiseSubmissionQueue(struct SubmissionQueue* queue, uint32_t totalProducers);
+
+/**
+ * Releases a queue, and any submissions still in it, once no thread is using it
+ */
+void freeSubmissionQueue(struct SubmissionQueue* queue);
+
+/**
+ * [Producer] Submits a process, arriving at cycle process->A, which also moves the producer's watermark up to it
+ * @return false if out of memory, the producer has been closed, or the process arrives before the producer's watermark
+ */
+bool submitProcess(struct SubmissionQueue* queue, uint32_t producerID, const struct ProcessSpecification* process);
+
+/**
+ * [Producer] Promises that the producer will submit nothing arriving before a cycle, letting the simulation run up to it
+ */
+void advanceSubmissionWatermark(struct SubmissionQueue* queue, uint32_t producerID, uint64_t cycle);
+
+/**
+ * [Producer] Promises that the producer will submit nothing more
+ */
+void closeSubmissionProducer(struct SubmissionQueue* queue, uint32_t producerID);
+
+/**
+ * [Simulation] Retrieves the lowest watermark of every producer, before which every process has been submitted
+ */
+uint64_t getSubmissionWatermark(struct SubmissionQueue* queue);
+
+/**
+ * [Simulation] Takes every submission off the stack, ready to be admitted in order
+ * @return false if out of memory
+ */
+bool collectSubmissions(struct SubmissionQueue* queue);
+
+/**
+ * [Simulation] Waits until every process arriving on or before a cycle has been submitted, then collects them
+ * @return false if out of memory
+ */
+bool waitForSubmissions(struct SubmissionQueue* queue, uint64_t cycle);
+
+/**
+ * [Simulation] Retrieves the collected submission to be admitted next, without removing it (NULL if there is none)
+ */
+const struct Submission* peekSubmission(const struct SubmissionQueue* queue);
+
+/**
+ * [Simulation] Removes the collected submission to be admitted next
+ * @param process Set to the process submitted
+ */
+void popSubmission(struct SubmissionQueue* queue, struct ProcessSpecification* process);
+
+/**
+ * [Simulation] Checks whether every producer has been closed, and every submission admitted
+ */
+bool isSubmissionQueueFinished(struct SubmissionQueue* queue);
+
+#endif // SUBMISSION_QUEUE_H
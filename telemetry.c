@@ -0,0 +1,140 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "telemetry.h"
+
+// Rows are written out once this many bytes have built up, so memory use stays constant however long the run
+#define TELEMETRY_FLUSH_THRESHOLD 65536
+
+/**
+ * Empties the current window, so that the next starts from the given cycle
+ */
+static void startTelemetryWindow(struct TelemetryRecorder* recorder, uint64_t startCycle, uint32_t finishedProcesses)
+{
+    recorder->windowStartCycle = startCycle;
+    recorder->cyclesInWindow = 0;
+    recorder->busyCycles = 0;
+    recorder->blockedCycles = 0;
+    recorder->readyDepthTotal = 0;
+    recorder->readyDepthMaximum = 0;
+    recorder->blockedSizeTotal = 0;
+    recorder->blockedSizeMaximum = 0;
+    recorder->finishedAtWindowStart = finishedProcesses;
+} // End of the start telemetry window function
+
+/**
+ * Opens the telemetry output file and writes the column names
+ */
+bool openTelemetryRecorder(struct TelemetryRecorder* recorder, const char* fileName, uint32_t windowLength)
+{
+    recorder->outputFile = fopen(fileName, "w");
+    if (recorder->outputFile == NULL)
+        return false;
+
+    recorder->windowLength = (windowLength == 0) ? 1 : windowLength;
+    recorder->label = "";
+    initialiseReportBuffer(&recorder->buffer);
+    startTelemetryWindow(recorder, 0, 0);
+
+    appendString(&recorder->buffer, "label\twindow_start\tcycles\tcpu_utilisation\tio_utilisation\tthroughput\t"
+                                    "ready_mean\tready_max\tblocked_mean\tblocked_max\n");
+    return true;
+} // End of the open telemetry recorder function
+
+/**
+ * Writes out any remaining rows and closes the output file
+ */
+void closeTelemetryRecorder(struct TelemetryRecorder* recorder)
+{
+    flushReportBuffer(&recorder->buffer, recorder->outputFile);
+    freeReportBuffer(&recorder->buffer);
+    fclose(recorder->outputFile);
+    recorder->outputFile = NULL;
+} // End of the close telemetry recorder function
+
+/**
+ * Adds a row for the current window (if it holds any cycles), and starts the next one
+ */
+static void writeTelemetryWindow(struct TelemetryRecorder* recorder, uint32_t finishedProcesses)
+{
+    if (recorder->cyclesInWindow != 0)
+    {
+        struct ReportBuffer* buffer = &recorder->buffer;
+        double cycles = recorder->cyclesInWindow;
+
+        appendString(buffer, recorder->label);
+        appendCharacter(buffer, '\t');
+        appendUnsignedInteger(buffer, recorder->windowStartCycle);
+        appendCharacter(buffer, '\t');
+        appendUnsignedInteger(buffer, recorder->cyclesInWindow);
+        appendCharacter(buffer, '\t');
+        appendFixedPoint(buffer, recorder->busyCycles / cycles);
+        appendCharacter(buffer, '\t');
+        appendFixedPoint(buffer, recorder->blockedCycles / cycles);
+        appendCharacter(buffer, '\t');
+        // Throughput is given in processes per hundred cycles, as in the summary data
+        appendFixedPoint(buffer, 100 * ((finishedProcesses - recorder->finishedAtWindowStart) / cycles));
+        appendCharacter(buffer, '\t');
+        appendFixedPoint(buffer, recorder->readyDepthTotal / cycles);
+        appendCharacter(buffer, '\t');
+        appendUnsignedInteger(buffer, recorder->readyDepthMaximum);
+        appendCharacter(buffer, '\t');
+        appendFixedPoint(buffer, recorder->blockedSizeTotal / cycles);
+        appendCharacter(buffer, '\t');
+        appendUnsignedInteger(buffer, recorder->blockedSizeMaximum);
+        appendCharacter(buffer, '\n');
+
+        if (buffer->length >= TELEMETRY_FLUSH_THRESHOLD)
+            flushReportBuffer(buffer, recorder->outputFile);
+    }
+    startTelemetryWindow(recorder, recorder->windowStartCycle + recorder->cyclesInWindow, finishedProcesses);
+} // End of the write telemetry window function
+
+/**
+ * Adds the state of a context to the current window, once it has simulated a cycle
+ */
+void recordTelemetryCycle(struct TelemetryRecorder* recorder, const struct SchedulerContext* context)
+{
+    recordTelemetryCycles(recorder, context, 1);
+} // End of the record telemetry cycle function
+
+/**
+ * Adds the state of a context to the windows once for each of a number of cycles it spent in that same state
+ */
+void recordTelemetryCycles(struct TelemetryRecorder* recorder, const struct SchedulerContext* context, uint64_t totalCycles)
+{
+    uint32_t readyDepth = context->readyProcessQueueSize + context->readySuspendedProcessQueueSize;
+
+    while (totalCycles != 0)
+    {
+        // Fills up the current window, or as much of it as there are cycles left
+        uint32_t cycles = recorder->windowLength - recorder->cyclesInWindow;
+        if (totalCycles < cycles)
+            cycles = (uint32_t) totalCycles;
+        totalCycles -= cycles;
+
+        recorder->cyclesInWindow += cycles;
+        if (context->currentRunningProcess != NULL)
+            recorder->busyCycles += cycles;
+        if (context->blockedProcessListSize != 0)
+            recorder->blockedCycles += cycles;
+        recorder->readyDepthTotal += (uint64_t) readyDepth * cycles;
+        if (readyDepth > recorder->readyDepthMaximum)
+            recorder->readyDepthMaximum = readyDepth;
+        recorder->blockedSizeTotal += (uint64_t) context->blockedProcessListSize * cycles;
+        if (context->blockedProcessListSize > recorder->blockedSizeMaximum)
+            recorder->blockedSizeMaximum = context->blockedProcessListSize;
+
+        if (recorder->cyclesInWindow == recorder->windowLength)
+            writeTelemetryWindow(recorder, context->totalFinishedProcesses);
+    }
+} // End of the record telemetry cycles function
+
+/**
+ * Writes out the last (possibly partial) window of a run, ready for the next run to start from cycle 0
+ */
+void finishTelemetryRun(struct TelemetryRecorder* recorder, const struct SchedulerContext* context)
+{
+    writeTelemetryWindow(recorder, context->totalFinishedProcesses);
+    startTelemetryWindow(recorder, 0, 0);
+} // End of the finish telemetry run function
@@ -0,0 +1,59 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "libscheduler.h"
+#include "reportWriter.h"
+
+/*
+ * Aggregates the state of a simulation over windows of a fixed number of cycles, writing one tab separated row per
+ * window: the CPU and I/O utilisation, throughput, and the mean and maximum ready queue depth and blocked list size.
+ */
+struct TelemetryRecorder {
+    FILE* outputFile;
+    uint32_t windowLength;              // The number of cycles aggregated into each row
+    const char* label;                  // Written in the first column of each row, e.g. the scheduler algorithm
+    struct ReportBuffer buffer;         // Rows not yet written out
+
+    uint64_t windowStartCycle;          // The first cycle of the current window
+    uint32_t cyclesInWindow;            // The number of cycles recorded in the current window
+    uint32_t busyCycles;                // Cycles of the current window with a process running
+    uint32_t blockedCycles;             // Cycles of the current window with at least one process blocked
+    uint64_t readyDepthTotal;           // Sum of the ready (and ready suspended) queue depth over the window
+    uint32_t readyDepthMaximum;
+    uint64_t blockedSizeTotal;          // Sum of the blocked list size over the window
+    uint32_t blockedSizeMaximum;
+    uint32_t finishedAtWindowStart;     // The number of finished processes when the window began
+};
+
+/**
+ * Opens the telemetry output file and writes the column names
+ * @param windowLength The number of cycles aggregated into each row (at least 1)
+ * @return false if the file could not be opened
+ */
+bool openTelemetryRecorder(struct TelemetryRecorder* recorder, const char* fileName, uint32_t windowLength);
+
+/**
+ * Writes out any remaining rows and closes the output file
+ */
+void closeTelemetryRecorder(struct TelemetryRecorder* recorder);
+
+/**
+ * Adds the state of a context to the current window, once it has simulated a cycle
+ */
+void recordTelemetryCycle(struct TelemetryRecorder* recorder, const struct SchedulerContext* context);
+
+/**
+ * Adds the state of a context to the current window once for each of a number of cycles spent in that same state,
+ * as when idle cycles are skipped over (see skipIdleCycles())
+ */
+void recordTelemetryCycles(struct TelemetryRecorder* recorder, const struct SchedulerContext* context, uint64_t totalCycles);
+
+/**
+ * Writes out the last (possibly partial) window of a run, ready for the next run to start from cycle 0
+ */
+void finishTelemetryRun(struct TelemetryRecorder* recorder, const struct SchedulerContext* context);
+
+#endif // TELEMETRY_H
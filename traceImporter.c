@@ -0,0 +1,597 @@
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "traceImporter.h"
+
+#define MAXIMUM_TRACE_TOKENS 32         // The most whitespace separated fields of a perf sched timehist line looked at
+
+/* The state of a single task while the trace is being read */
+struct TaskState {
+    bool hasRun;                        // Whether any of the task's run has been seen yet (its arrival time is set)
+    bool isRunning;                     // Whether the task is switched in
+    bool isSleeping;                    // Whether the task was switched out asleep, rather than preempted
+    bool isWoken;                       // Whether the task has been woken since it was last switched out
+    bool isExited;                      // Whether the task has exited, so that a later task with its thread ID is new
+    uint64_t switchInTime;              // When the task was last switched in
+    uint64_t readyTime;                 // When the task last became ready to run
+    uint64_t sleepTime;                 // How long the task slept before it was last switched in
+    uint64_t sleepStartTime;            // When the task was last switched out asleep
+    uint64_t wakeupTime;                // When the task was last woken
+    uint64_t burstTime;                 // The time run so far in the CPU burst not yet finished
+};
+
+/* Every task seen so far, while the trace is being read, with all times in nanoseconds */
+struct TraceImport {
+    struct BurstTrace* trace;           // The tasks in the order they were first seen
+    struct TaskState* states;           // The state of each task of the trace
+    uint32_t taskCapacity;              // The number of tasks the trace and states have room for
+    uint32_t* taskTable;                // An open addressing hash table of the latest task of each thread ID (index + 1)
+    uint32_t taskTableSize;             // Always a power of two, at least twice the number of tasks
+    uint64_t cycleLength;
+    bool hasStarted;                    // Whether any event has been read
+    uint64_t startTime;                 // The earliest time read, which cycle 0 is simulated from
+    uint64_t lastTime;                  // The time of the latest event read
+};
+
+/************************ START OF TASK FUNCTIONS *************************************/
+
+/**
+ * Converts a time in nanoseconds into cycles, to the nearest cycle
+ */
+static uint64_t toCycles(const struct TraceImport* import, uint64_t time)
+{
+    return (time + import->cycleLength / 2) / import->cycleLength;
+} // End of the to cycles function
+
+/**
+ * Retrieves the time from one event to a later one (0 should the events be out of order)
+ */
+static uint64_t getElapsedTime(uint64_t startTime, uint64_t endTime)
+{
+    return (endTime > startTime) ? endTime - startTime : 0;
+} // End of the get elapsed time function
+
+/**
+ * Finds the slot of the hash table that holds a thread ID, or the empty slot it would go in
+ */
+static uint32_t findTaskSlot(const struct TraceImport* import, uint32_t taskID)
+{
+    uint32_t slot = (taskID * 2654435761u) & (import->taskTableSize - 1);
+    while ((import->taskTable[slot] != 0) && (import->trace->tasks[import->taskTable[slot] - 1].taskID != taskID))
+        slot = (slot + 1) & (import->taskTableSize - 1);
+    return slot;
+} // End of the find task slot function
+
+/**
+ * Doubles the size of the hash table, keeping the latest task of each thread ID
+ */
+static bool growTaskTable(struct TraceImport* import)
+{
+    uint32_t* grownTable = calloc(import->taskTableSize * 2, sizeof(uint32_t));
+    if (grownTable == NULL)
+        return false;
+    free(import->taskTable);
+    import->taskTable = grownTable;
+    import->taskTableSize *= 2;
+
+    // The tasks are put back in the order they were seen, so each thread ID ends up with its latest task
+    uint32_t i = 0;
+    for (; i < import->trace->totalTasks; ++i)
+        import->taskTable[findTaskSlot(import, import->trace->tasks[i].taskID)] = i + 1;
+    return true;
+} // End of the grow task table function
+
+/**
+ * Finds the task currently running under a thread ID, adding a new one if there is none
+ * @return The index of the task, or UINT32_MAX if out of memory
+ */
+static uint32_t findTask(struct TraceImport* import, uint32_t taskID)
+{
+    uint32_t slot = findTaskSlot(import, taskID);
+    if ((import->taskTable[slot] != 0) && !import->states[import->taskTable[slot] - 1].isExited)
+        return import->taskTable[slot] - 1;
+
+    struct BurstTrace* trace = import->trace;
+    if (trace->totalTasks == import->taskCapacity)
+    {
+        // Out of room, doubles the capacity
+        uint32_t capacity = (import->taskCapacity == 0) ? 64 : import->taskCapacity * 2;
+        struct TracedTask* grownTasks = realloc(trace->tasks, capacity * sizeof(struct TracedTask));
+        if (grownTasks == NULL)
+            return UINT32_MAX;
+        trace->tasks = grownTasks;
+        struct TaskState* grownStates = realloc(import->states, capacity * sizeof(struct TaskState));
+        if (grownStates == NULL)
+            return UINT32_MAX;
+        import->states = grownStates;
+        import->taskCapacity = capacity;
+    }
+
+    uint32_t taskIndex = trace->totalTasks++;
+    memset(&trace->tasks[taskIndex], 0, sizeof(struct TracedTask));
+    memset(&import->states[taskIndex], 0, sizeof(struct TaskState));
+    trace->tasks[taskIndex].taskID = taskID;
+    import->taskTable[slot] = taskIndex + 1;
+
+    if ((2 * trace->totalTasks >= import->taskTableSize) && !growTaskTable(import))
+        return UINT32_MAX;
+    return taskIndex;
+} // End of the find task function
+
+/**
+ * Finishes the CPU burst a task has been running, and adds it to the task's bursts
+ * @param IOTime How long the task then slept for
+ */
+static bool finishBurst(struct TraceImport* import, uint32_t taskIndex, uint64_t IOTime)
+{
+    struct TracedTask* task = &import->trace->tasks[taskIndex];
+    if (task->totalBursts == task->burstCapacity)
+    {
+        // Out of room, doubles the capacity
+        uint64_t capacity = (task->burstCapacity == 0) ? 8 : task->burstCapacity * 2;
+        uint64_t* grownCPUBursts = realloc(task->CPUBursts, capacity * sizeof(uint64_t));
+        if (grownCPUBursts == NULL)
+            return false;
+        task->CPUBursts = grownCPUBursts;
+        uint64_t* grownIOBursts = realloc(task->IOBursts, capacity * sizeof(uint64_t));
+        if (grownIOBursts == NULL)
+            return false;
+        task->IOBursts = grownIOBursts;
+        task->burstCapacity = capacity;
+    }
+
+    // Every CPU burst runs for at least a cycle, as in the engine
+    uint64_t CPUBurst = toCycles(import, import->states[taskIndex].burstTime);
+    task->CPUBursts[task->totalBursts] = (CPUBurst == 0) ? 1 : CPUBurst;
+    task->IOBursts[task->totalBursts] = toCycles(import, IOTime);
+    ++task->totalBursts;
+    import->states[taskIndex].burstTime = 0;
+    return true;
+} // End of the finish burst function
+
+/**
+ * Adds a single run of a task, from being switched in to being switched out
+ * @param readyTime When the task became ready to run, before it was switched in
+ * @param sleepTime How long the task slept before it became ready, which finishes its last CPU burst if long enough
+ */
+static bool recordRun(struct TraceImport* import, uint32_t taskIndex, uint64_t readyTime, uint64_t startTime,
+                      uint64_t endTime, uint64_t sleepTime)
+{
+    struct TaskState* state = &import->states[taskIndex];
+    if (!state->hasRun)
+    {
+        state->hasRun = true;
+        import->trace->tasks[taskIndex].arrivalTime = readyTime;
+    }
+    else if ((toCycles(import, sleepTime) != 0) && !finishBurst(import, taskIndex, sleepTime))
+        return false;
+
+    // A run after being preempted, or after too short a sleep, carries on the same CPU burst
+    state->burstTime += getElapsedTime(startTime, endTime);
+    return true;
+} // End of the record run function
+
+/**
+ * Finishes the last CPU burst of a task that has exited, so that a later task with its thread ID is a new one
+ */
+static bool recordExit(struct TraceImport* import, uint32_t taskIndex)
+{
+    struct TaskState* state = &import->states[taskIndex];
+    state->isExited = true;
+    return !state->hasRun || finishBurst(import, taskIndex, 0);
+} // End of the record exit function
+
+/************************ END OF TASK FUNCTIONS *************************************/
+
+/************************ START OF PARSING FUNCTIONS *************************************/
+
+/**
+ * Parses a non-negative decimal number, e.g. "5000.123456", as an integer count of a fraction of its unit
+ * @param fractionDigits The number of decimal places kept, e.g. 9 to count the nanoseconds of a time in seconds
+ * @param value Set to the number, times 10 to the power of fractionDigits
+ * @return The character after the number, or NULL if there is no number
+ */
+static const char* parseDecimal(const char* text, uint8_t fractionDigits, uint64_t* value)
+{
+    if (!isdigit((unsigned char) *text))
+        return NULL;
+
+    uint64_t number = 0;
+    for (; isdigit((unsigned char) *text); ++text)
+        number = number * 10 + (uint64_t) (*text - '0');
+    if (*text == '.')
+        ++text;
+    uint8_t i = 0;
+    for (; i < fractionDigits; ++i)
+    {
+        number *= 10;
+        if (isdigit((unsigned char) *text))
+            number += (uint64_t) (*text++ - '0');
+    }
+    // Any further digits are beyond the precision kept
+    while (isdigit((unsigned char) *text))
+        ++text;
+    *value = number;
+    return text;
+} // End of the parse decimal function
+
+/**
+ * Checks whether a whole field is a decimal number, as in the columns of perf sched timehist
+ */
+static bool isDecimalField(const char* field, uint8_t fractionDigits, uint64_t* value)
+{
+    const char* end = parseDecimal(field, fractionDigits, value);
+    return (end != NULL) && (*end == '\0');
+} // End of the is decimal field function
+
+/**
+ * Notes a time read from the trace, the earliest of which is the start of the trace
+ */
+static void recordEventTime(struct TraceImport* import, uint64_t time)
+{
+    if (!import->hasStarted || (time < import->startTime))
+        import->startTime = time;
+    if (!import->hasStarted || (time > import->lastTime))
+        import->lastTime = time;
+    import->hasStarted = true;
+} // End of the record event time function
+
+/**
+ * Reads a perf sched timehist line, e.g. "  79371.874569 [0011]  gcc[31949]   0.014   0.000   1.148", which is a task
+ * being switched out, with the time it was switched out, its wait time (since it was last switched out), scheduling
+ * delay (from being woken to being switched in) and run time, the last three in milliseconds
+ * @return false if out of memory (any other line is skipped)
+ */
+static bool readPerfLine(struct TraceImport* import, char* line)
+{
+    // Splits the line into fields
+    char* fields[MAXIMUM_TRACE_TOKENS];
+    uint32_t totalFields = 0;
+    char* field = strtok(line, " \t\r\n");
+    for (; (field != NULL) && (totalFields < MAXIMUM_TRACE_TOKENS); field = strtok(NULL, " \t\r\n"))
+        fields[totalFields++] = field;
+
+    // The time, the CPU in brackets, the task, then the wait time, scheduling delay, run time and an optional state
+    uint64_t time;
+    if ((totalFields < 6) || !isDecimalField(fields[0], 9, &time) || (fields[1][0] != '['))
+        return true;
+    uint32_t last = totalFields - 1;
+    char state = 'R';
+    uint64_t runTime;
+    if (!isDecimalField(fields[last], 6, &runTime))
+    {
+        state = fields[last][0];
+        --last;
+    }
+    uint64_t waitTime;
+    uint64_t delayTime;
+    if ((last < 5) || !isDecimalField(fields[last], 6, &runTime) || !isDecimalField(fields[last - 1], 6, &delayTime)
+        || !isDecimalField(fields[last - 2], 6, &waitTime))
+        return true;
+
+    // The task is given as comm[tid] or comm[tid/pid], where the comm may itself hold brackets
+    char* taskField = fields[last - 3];
+    char* bracket = strrchr(taskField, '[');
+    if ((bracket == NULL) || (taskField[strlen(taskField) - 1] != ']') || !isdigit((unsigned char) bracket[1]))
+        return true;
+    uint32_t taskID = (uint32_t) strtoul(bracket + 1, NULL, 10);
+    recordEventTime(import, time);
+    if (taskID == 0)
+        return true;            // The idle task
+
+    uint32_t taskIndex = findTask(import, taskID);
+    if (taskIndex == UINT32_MAX)
+        return false;
+
+    // The wait time is the time asleep then the scheduling delay
+    uint64_t startTime = getElapsedTime(runTime, time);
+    uint64_t readyTime = getElapsedTime(delayTime, startTime);
+    recordEventTime(import, readyTime);
+    if (!recordRun(import, taskIndex, readyTime, startTime, time, getElapsedTime(delayTime, waitTime)))
+        return false;
+    return ((state != 'X') && (state != 'Z')) || recordExit(import, taskIndex);
+} // End of the read perf line function
+
+/**
+ * Finds the thread ID and state of the task of an ftrace event, given either as key=value fields (e.g. "prev_pid=12
+ * prev_state=S") or in the trace-cmd style (e.g. "bash:12 [120] S")
+ * @param text The event's fields, from the task onwards
+ * @param taskIDKey The key of the thread ID, e.g. "prev_pid="
+ * @param stateKey The key of the state, e.g. "prev_state=" (NULL if it is not needed)
+ * @return false if there is no thread ID
+ */
+static bool parseEventTask(const char* text, const char* taskIDKey, const char* stateKey, uint32_t* taskID,
+                           char* state)
+{
+    const char* value = strstr(text, taskIDKey);
+    if (value != NULL)
+    {
+        value += strlen(taskIDKey);
+        if (stateKey != NULL)
+        {
+            const char* stateValue = strstr(text, stateKey);
+            *state = (stateValue == NULL) ? 'R' : stateValue[strlen(stateKey)];
+        }
+    }
+    else
+    {
+        // comm:tid [prio] state, where the comm may itself hold colons
+        while (isspace((unsigned char) *text))
+            ++text;
+        const char* end = text;
+        while ((*end != '\0') && !isspace((unsigned char) *end))
+            ++end;
+        value = end;
+        while ((value > text) && (value[-1] != ':'))
+            --value;
+        if (value == text)
+            return false;
+        if (stateKey != NULL)
+        {
+            const char* stateValue = strchr(end, ']');
+            stateValue = (stateValue == NULL) ? end : stateValue + 1;
+            while (isspace((unsigned char) *stateValue))
+                ++stateValue;
+            *state = *stateValue;
+        }
+    }
+
+    if (!isdigit((unsigned char) *value))
+        return false;
+    *taskID = (uint32_t) strtoul(value, NULL, 10);
+    return true;
+} // End of the parse event task function
+
+/**
+ * Reads an ftrace event line, e.g. "  bash-1234  [001] d..2  5000.123456: sched_switch: prev_comm=bash prev_pid=1234
+ * prev_prio=120 prev_state=S ==> next_comm=swapper/1 next_pid=0 next_prio=120"
+ * @param event Where the event's name starts in the line
+ * @return false if out of memory (any other line is skipped)
+ */
+static bool readFtraceLine(struct TraceImport* import, const char* line, const char* event)
+{
+    // The time is the field just before the event name, e.g. "5000.123456:"
+    const char* timeEnd = event;
+    while ((timeEnd > line) && isspace((unsigned char) timeEnd[-1]))
+        --timeEnd;
+    if ((timeEnd == line) || (timeEnd[-1] != ':'))
+        return true;
+    const char* timeStart = timeEnd - 1;
+    while ((timeStart > line) && (isdigit((unsigned char) timeStart[-1]) || (timeStart[-1] == '.')))
+        --timeStart;
+    uint64_t time;
+    if (parseDecimal(timeStart, 9, &time) != timeEnd - 1)
+        return true;
+
+    const char* fields = strchr(event, ':') + 1;
+    uint32_t taskIndex;
+    if (strncmp(event, "sched_switch:", 13) != 0)
+    {
+        // A wakeup, which ends the task's sleep (or, for a new task, is when it arrives)
+        uint32_t taskID;
+        if (!parseEventTask(fields, " pid=", NULL, &taskID, NULL))
+            return true;
+        recordEventTime(import, time);
+        if (taskID == 0)
+            return true;
+        taskIndex = findTask(import, taskID);
+        if (taskIndex == UINT32_MAX)
+            return false;
+        struct TaskState* state = &import->states[taskIndex];
+        if (!state->isRunning && !state->isWoken)
+        {
+            state->isWoken = true;
+            state->wakeupTime = time;
+        }
+        return true;
+    }
+
+    // A switch, from the previous task (before the "==>") to the next one
+    const char* arrow = strstr(fields, "==>");
+    uint32_t previousTaskID;
+    uint32_t nextTaskID;
+    char previousState = 'R';
+    char nextState;
+    if ((arrow == NULL) || !parseEventTask(fields, "prev_pid=", "prev_state=", &previousTaskID, &previousState)
+        || !parseEventTask(arrow + 3, "next_pid=", NULL, &nextTaskID, &nextState))
+        return true;
+    recordEventTime(import, time);
+
+    if (previousTaskID != 0)
+    {
+        taskIndex = findTask(import, previousTaskID);
+        if (taskIndex == UINT32_MAX)
+            return false;
+        struct TaskState* state = &import->states[taskIndex];
+        // A task already running when the trace started has no run to record
+        if (state->isRunning
+            && !recordRun(import, taskIndex, state->readyTime, state->switchInTime, time, state->sleepTime))
+            return false;
+        state->isRunning = false;
+        state->isWoken = false;
+
+        // A runnable task was preempted, and an exiting one is done, otherwise it has gone to sleep
+        if ((previousState == 'X') || (previousState == 'Z'))
+        {
+            if (!recordExit(import, taskIndex))
+                return false;
+        }
+        else
+        {
+            state->isSleeping = previousState != 'R';
+            state->sleepStartTime = time;
+        }
+    }
+
+    if (nextTaskID != 0)
+    {
+        taskIndex = findTask(import, nextTaskID);
+        if (taskIndex == UINT32_MAX)
+            return false;
+        struct TaskState* state = &import->states[taskIndex];
+        state->readyTime = state->isWoken ? state->wakeupTime : time;
+        state->sleepTime = state->isSleeping ? getElapsedTime(state->sleepStartTime, state->readyTime) : 0;
+        state->isRunning = true;
+        state->isSleeping = false;
+        state->isWoken = false;
+        state->switchInTime = time;
+    }
+    return true;
+} // End of the read ftrace line function
+
+/**
+ * Reads a line of the trace, skipping the rest of any line too long to fit
+ * @return false at the end of the trace
+ */
+static bool readTraceLine(FILE* traceFile, char line[TRACE_LINE_LENGTH])
+{
+    if (fgets(line, TRACE_LINE_LENGTH, traceFile) == NULL)
+        return false;
+    size_t length = strlen(line);
+    if ((length == TRACE_LINE_LENGTH - 1) && (line[length - 1] != '\n'))
+    {
+        int32_t character = fgetc(traceFile);
+        while ((character != '\n') && (character != EOF))
+            character = fgetc(traceFile);
+    }
+    return true;
+} // End of the read trace line function
+
+/************************ END OF PARSING FUNCTIONS *************************************/
+
+/************************ START OF TRACE FUNCTIONS *************************************/
+
+/**
+ * Orders tasks by arrival time, then by thread ID, for qsort()
+ */
+static int compareTasks(const void* first, const void* second)
+{
+    const struct TracedTask* firstTask = first;
+    const struct TracedTask* secondTask = second;
+    if (firstTask->arrivalTime != secondTask->arrivalTime)
+        return (firstTask->arrivalTime < secondTask->arrivalTime) ? -1 : 1;
+    if (firstTask->taskID != secondTask->taskID)
+        return (firstTask->taskID < secondTask->taskID) ? -1 : 1;
+    return 0;
+} // End of the compare tasks function
+
+/**
+ * Finishes the CPU burst of every task still alive at the end of the trace, then keeps only the tasks that ran, in
+ * order of arrival
+ */
+static bool finishTrace(struct TraceImport* import)
+{
+    struct BurstTrace* trace = import->trace;
+    uint32_t i = 0;
+    for (; i < trace->totalTasks; ++i)
+    {
+        struct TaskState* state = &import->states[i];
+        if (state->isRunning
+            && !recordRun(import, i, state->readyTime, state->switchInTime, import->lastTime, state->sleepTime))
+            return false;
+        if (state->hasRun && !state->isExited && !finishBurst(import, i, 0))
+            return false;
+    }
+
+    // Only once nothing more can fail are the tasks that never ran dropped
+    uint32_t totalTasks = 0;
+    for (i = 0; i < trace->totalTasks; ++i)
+    {
+        struct TracedTask* task = &trace->tasks[i];
+        if (task->totalBursts == 0)
+        {
+            free(task->CPUBursts);
+            free(task->IOBursts);
+            continue;
+        }
+        task->arrivalTime = toCycles(import, getElapsedTime(import->startTime, task->arrivalTime));
+        trace->tasks[totalTasks++] = *task;
+    }
+    trace->totalTasks = totalTasks;
+    if (trace->totalTasks != 0)
+        qsort(trace->tasks, trace->totalTasks, sizeof(struct TracedTask), compareTasks);
+    return true;
+} // End of the finish trace function
+
+/**
+ * Reads every task's bursts from a perf sched timehist or ftrace sched_switch text dump
+ */
+bool importBurstTrace(FILE* traceFile, uint64_t cycleLength, struct BurstTrace* trace)
+{
+    struct TraceImport import;
+    memset(&import, 0, sizeof(import));
+    trace->tasks = NULL;
+    trace->totalTasks = 0;
+    import.trace = trace;
+    import.cycleLength = (cycleLength == 0) ? 1 : cycleLength;
+    import.taskTableSize = 128;
+    import.taskTable = calloc(import.taskTableSize, sizeof(uint32_t));
+    char* line = malloc(TRACE_LINE_LENGTH);
+
+    bool isImported = (import.taskTable != NULL) && (line != NULL);
+    while (isImported && readTraceLine(traceFile, line))
+    {
+        const char* event = strstr(line, "sched_switch:");
+        if (event == NULL)
+            event = strstr(line, "sched_wakeup:");
+        if (event == NULL)
+            event = strstr(line, "sched_wakeup_new:");
+        isImported = (event != NULL) ? readFtraceLine(&import, line, event) : readPerfLine(&import, line);
+    }
+    isImported = isImported && finishTrace(&import) && (trace->totalTasks != 0);
+
+    free(line);
+    free(import.taskTable);
+    free(import.states);
+    if (!isImported)
+        freeBurstTrace(trace);
+    return isImported;
+} // End of the import burst trace function
+
+/**
+ * Releases the memory held by a trace
+ */
+void freeBurstTrace(struct BurstTrace* trace)
+{
+    uint32_t i = 0;
+    for (; i < trace->totalTasks; ++i)
+    {
+        free(trace->tasks[i].CPUBursts);
+        free(trace->tasks[i].IOBursts);
+    }
+    free(trace->tasks);
+    trace->tasks = NULL;
+    trace->totalTasks = 0;
+} // End of the free burst trace function
+
+/**
+ * Builds the mix replayed from a trace
+ */
+bool getTracedWorkload(const struct BurstTrace* trace, struct ProcessSpecification** workload)
+{
+    struct ProcessSpecification* processes = calloc(trace->totalTasks + 1, sizeof(struct ProcessSpecification));
+    if (processes == NULL)
+        return false;
+
+    uint32_t i = 0;
+    for (; i < trace->totalTasks; ++i)
+    {
+        const struct TracedTask* task = &trace->tasks[i];
+        uint64_t totalIOTime = 0;
+        uint64_t j = 0;
+        processes[i].A = task->arrivalTime;
+        for (; j < task->totalBursts; ++j)
+        {
+            processes[i].C += task->CPUBursts[j];
+            totalIOTime += task->IOBursts[j];
+            if (task->CPUBursts[j] > processes[i].B)
+                processes[i].B = task->CPUBursts[j];
+        }
+        processes[i].M = (totalIOTime + processes[i].C / 2) / processes[i].C;
+    }
+    *workload = processes;
+    return true;
+} // End of the get traced workload function
+
+/************************ END OF TRACE FUNCTIONS *************************************/
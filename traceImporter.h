@@ -0,0 +1,63 @@
+#ifndef TRACE_IMPORTER_H
+#define TRACE_IMPORTER_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "libscheduler.h"
+
+/*
+ * Imports the CPU and I/O bursts of every task in a text dump of real scheduling events, so that they can be replayed
+ * through the engine in place of randomOS() (see SchedulerContext.burstTrace). Two dump formats are read, even mixed in
+ * the one file:
+ *  - `perf sched timehist`, where each line is a task being switched out, with its wait time, scheduling delay and run
+ *    time (an optional state column after the run time is also read)
+ *  - ftrace `sched_switch` events (e.g. from trace-cmd report or /sys/kernel/tracing/trace), along with any
+ *    `sched_wakeup` and `sched_wakeup_new` events, which separate the time a task slept from the time it was ready
+ * A CPU burst is the time a task spent running between two sleeps, however many times it was preempted in between,
+ * and the I/O burst after it is the time it then slept until it was woken. Sleeps shorter than half a cycle are not
+ * counted as sleeps. The trace is read a line at a time, so only the bursts are held in memory, never the trace itself.
+ */
+
+#define TRACE_LINE_LENGTH 4096          // Longer lines are cut short, which only ever drops a comm or trailing fields
+
+/* The bursts of a single task of a trace, in cycles */
+struct TracedTask {
+    uint32_t taskID;                    // The thread ID (pid) of the task in the trace
+    uint64_t arrivalTime;               // The cycle the task first became ready, counted from the start of the trace
+    uint64_t* CPUBursts;                // Each CPU burst, at least 1 cycle long, in the order they ran
+    uint64_t* IOBursts;                 // The I/O burst after each CPU burst (0 after the last, unless it slept then)
+    uint64_t totalBursts;
+    uint64_t burstCapacity;             // The number of bursts CPUBursts and IOBursts have room for
+};
+
+/* The bursts of every task of a trace */
+struct BurstTrace {
+    struct TracedTask* tasks;           // In order of arrival time, then thread ID, so that task i is replayed as process i
+    uint32_t totalTasks;
+};
+
+/**
+ * Reads every task's bursts from a perf sched timehist or ftrace sched_switch text dump
+ * @param traceFile The dump, read a line at a time up to its end
+ * @param cycleLength The length of a simulated cycle, in nanoseconds
+ * @param trace The trace to fill in, to be released with freeBurstTrace()
+ * @return false if out of memory, or there are no scheduling events in the dump
+ */
+bool importBurstTrace(FILE* traceFile, uint64_t cycleLength, struct BurstTrace* trace);
+
+/**
+ * Releases the memory held by a trace
+ */
+void freeBurstTrace(struct BurstTrace* trace);
+
+/**
+ * Builds the mix replayed from a trace: each task arrives at its arrival time, with C the total of its CPU bursts, B its
+ * longest CPU burst, and M its total I/O time over its total CPU time, rounded (B and M are only shown in the reports,
+ * as every burst comes from the trace)
+ * @param workload Set to a newly allocated array of trace->totalTasks processes, to be released with free()
+ * @return false if out of memory
+ */
+bool getTracedWorkload(const struct BurstTrace* trace, struct ProcessSpecification** workload);
+
+#endif // TRACE_IMPORTER_H
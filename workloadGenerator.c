@@ -0,0 +1,352 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <inttypes.h>
+#include <math.h>
+
+#include "libscheduler.h"
+
+/*
+ * Generates synthetic mixes in the ABCM format (or the binary format), of any size, for the scheduler to read.
+ * Processes are written out as they are generated, so memory use is constant however many are asked for.
+ */
+
+// The largest value drawn, which is the largest integer a double holds exactly (2^53)
+#define MAXIMUM_VALUE 9007199254740992.0
+
+// Pi, as M_PI is not part of ISO C
+#define GENERATOR_PI 3.14159265358979323846
+
+/* Defines a distribution that the B, C or M values are drawn from */
+struct ValueDistribution {
+    uint8_t type;                       // 0 is constant, 1 is uniform, 2 is pareto, 3 is lognormal
+    double firstParameter;              // constant: value, uniform: minimum, pareto: alpha, lognormal: mu
+    double secondParameter;             // uniform: maximum, pareto: minimum, lognormal: sigma
+    double maximum;                     // Values are capped to this (heavy tails can otherwise overflow)
+    double minimum;                     // Values are raised to at least this
+};
+
+/* Defines how the arrival times are spaced out */
+struct ArrivalProcess {
+    uint8_t type;                       // 0 is poisson, 1 is bursty, 2 is diurnal
+    double rate;                        // The mean number of arrivals per cycle
+    double factor;                      // bursty: rate multiplier during bursts, diurnal: amplitude in [0, 1]
+    double period;                      // bursty: mean length of each burst and lull, diurnal: length of a day
+};
+
+/* The state of the sequential random number generator (splitmix64) */
+uint64_t GENERATOR_STATE = 0;
+
+/**
+ * Retrieves the next 64 random bits
+ */
+uint64_t nextRandomBits()
+{
+    uint64_t value = (GENERATOR_STATE += 0x9e3779b97f4a7c15ULL);
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+} // End of the next random bits function
+
+/**
+ * Retrieves a uniformly distributed random number in the interval (0, 1]
+ */
+double nextUniform()
+{
+    return ((nextRandomBits() >> 11) + 1) * (1.0 / 9007199254740992.0);
+} // End of the next uniform function
+
+/**
+ * Retrieves a normally distributed random number, with mean 0 and standard deviation 1 (Box-Muller)
+ */
+double nextNormal()
+{
+    return sqrt(-2.0 * log(nextUniform())) * cos(2.0 * GENERATOR_PI * nextUniform());
+} // End of the next normal function
+
+/**
+ * Draws a single value from a distribution, rounded and capped to fit its bounds
+ */
+uint64_t drawValue(const struct ValueDistribution* distribution)
+{
+    double value;
+    switch (distribution->type)
+    {
+        case 0:
+            value = distribution->firstParameter;
+            break;
+        case 1:
+            value = distribution->firstParameter
+                    + floor(nextUniform() * (distribution->secondParameter - distribution->firstParameter + 1));
+            break;
+        case 2:
+            value = floor(distribution->secondParameter / pow(nextUniform(), 1.0 / distribution->firstParameter));
+            break;
+        default:
+            value = floor(exp(distribution->firstParameter + distribution->secondParameter * nextNormal()));
+            break;
+    }
+
+    if (value > distribution->maximum)
+        value = distribution->maximum;
+    if (value < distribution->minimum)
+        value = distribution->minimum;
+    return (uint64_t) value;
+} // End of the draw value function
+
+/**
+ * Reads a distribution in the "type:parameter:parameter[:maximum]" format, e.g. "pareto:1.5:50:100000"
+ * @return false if the distribution is not recognised, or its parameters are out of range (such as a uniform minimum
+ * above its maximum)
+ */
+bool parseDistribution(const char* text, double minimum, struct ValueDistribution* distribution)
+{
+    char type[16];
+    int32_t totalParameters;
+    distribution->secondParameter = 0.0;
+    distribution->maximum = MAXIMUM_VALUE;
+    distribution->minimum = minimum;
+
+    totalParameters = sscanf(text, "%15[a-z]:%lf:%lf:%lf", type, &distribution->firstParameter,
+                             &distribution->secondParameter, &distribution->maximum);
+    if ((totalParameters < 2) || isnan(distribution->firstParameter) || isnan(distribution->secondParameter)
+        || isnan(distribution->maximum))
+        return false;
+    if (strcmp(type, "constant") == 0)
+        distribution->type = 0;
+    else if ((strcmp(type, "uniform") == 0) && (totalParameters >= 3)
+             && (distribution->firstParameter <= distribution->secondParameter))
+        distribution->type = 1;
+    else if ((strcmp(type, "pareto") == 0) && (totalParameters >= 3) && (distribution->firstParameter > 0)
+             && (distribution->secondParameter > 0))
+        distribution->type = 2;
+    else if ((strcmp(type, "lognormal") == 0) && (totalParameters >= 3) && (distribution->secondParameter >= 0))
+        distribution->type = 3;
+    else
+        return false;
+
+    if (distribution->maximum > MAXIMUM_VALUE)
+        distribution->maximum = MAXIMUM_VALUE;
+    return true;
+} // End of the parse distribution function
+
+/**
+ * Reads an arrival process in the "type:rate[:factor:period]" format, e.g. "diurnal:0.05:0.8:86400"
+ * @return false if the arrival process is not recognised
+ */
+bool parseArrivalProcess(const char* text, struct ArrivalProcess* arrivals)
+{
+    char type[16];
+    arrivals->factor = 10.0;
+    arrivals->period = 1000.0;
+
+    int32_t totalParameters = sscanf(text, "%15[a-z]:%lf:%lf:%lf", type, &arrivals->rate,
+                                     &arrivals->factor, &arrivals->period);
+    if ((totalParameters < 2) || isnan(arrivals->rate) || (arrivals->rate <= 0) || isnan(arrivals->period)
+        || (arrivals->period <= 0))
+        return false;
+    if (strcmp(type, "poisson") == 0)
+        arrivals->type = 0;
+    else if ((strcmp(type, "bursty") == 0) && (arrivals->factor >= 1))
+        arrivals->type = 1;
+    else if ((strcmp(type, "diurnal") == 0) && (arrivals->factor >= 0) && (arrivals->factor <= 1))
+        arrivals->type = 2;
+    else
+        return false;
+    return true;
+} // End of the parse arrival process function
+
+/**
+ * Reads the number of processes to generate, which has to be a plain decimal number that the scheduler can read back
+ * @return false if it is not a number, or is more than MAXIMUM_WORKLOAD_PROCESSES
+ */
+bool parseProcessCount(const char* text, uint32_t* totalProcesses)
+{
+    if ((*text < '0') || (*text > '9'))
+        return false;
+    char* end;
+    errno = 0;
+    unsigned long long count = strtoull(text, &end, 10);
+    if ((*end != '\0') || (errno == ERANGE) || (count > MAXIMUM_WORKLOAD_PROCESSES))
+        return false;
+    *totalProcesses = (uint32_t) count;
+    return true;
+} // End of the parse process count function
+
+/**
+ * Advances the time to the next arrival
+ * @param currentTime The time of the previous arrival, in (fractional) cycles
+ * @param isInBurst For bursty arrivals, whether a burst is under way, updated as bursts start and end
+ * @param stateEndTime For bursty arrivals, when the current burst or lull ends, updated as bursts start and end
+ */
+double nextArrivalTime(const struct ArrivalProcess* arrivals, double currentTime, bool* isInBurst, double* stateEndTime)
+{
+    switch (arrivals->type)
+    {
+        case 0:
+            // Poisson, with exponentially distributed gaps between arrivals
+            return currentTime - log(nextUniform()) / arrivals->rate;
+        case 1:
+            // Bursty, alternating between bursts and lulls of exponentially distributed lengths
+            while (true)
+            {
+                double rate = (*isInBurst) ? arrivals->rate * arrivals->factor : arrivals->rate / arrivals->factor;
+                double candidateTime = currentTime - log(nextUniform()) / rate;
+                if (candidateTime < *stateEndTime)
+                    return candidateTime;
+
+                // The burst or lull ended first, so switches over (gaps are memoryless, so may be redrawn)
+                currentTime = *stateEndTime;
+                *isInBurst = !*isInBurst;
+                *stateEndTime = currentTime - log(nextUniform()) * arrivals->period;
+            }
+        default:
+            // Diurnal, with the rate following a sine wave over each day (drawn by thinning the peak rate)
+            while (true)
+            {
+                double peakRate = arrivals->rate * (1.0 + arrivals->factor);
+                currentTime -= log(nextUniform()) / peakRate;
+                double rate = arrivals->rate * (1.0 + arrivals->factor * sin(2.0 * GENERATOR_PI * currentTime / arrivals->period));
+                if (nextUniform() * peakRate <= rate)
+                    return currentTime;
+            }
+    }
+} // End of the next arrival time function
+
+/**
+ * Writes a little endian 32 bit unsigned integer, as used in the binary mix format (see VERSIONED_BINARY_WORKLOAD_MAGIC)
+ */
+void writeLittleEndian32(FILE* outputFile, uint32_t value)
+{
+    unsigned char bytes[4] = {(unsigned char) value, (unsigned char) (value >> 8),
+                              (unsigned char) (value >> 16), (unsigned char) (value >> 24)};
+    fwrite(bytes, 1, 4, outputFile);
+} // End of the write little endian 32 function
+
+/**
+ * Writes a little endian 64 bit unsigned integer, as used in the binary mix format
+ */
+void writeLittleEndian64(FILE* outputFile, uint64_t value)
+{
+    writeLittleEndian32(outputFile, (uint32_t) value);
+    writeLittleEndian32(outputFile, (uint32_t) (value >> 32));
+} // End of the write little endian 64 function
+
+/**
+ * Prints out how to run the generator
+ */
+void printUsage(const char* programName)
+{
+    fprintf(stderr, "Usage: %s [--seed <seed>] [--arrival <process>] [--B <distribution>] [--C <distribution>]\n"
+                    "       [--M <distribution>] [--D <distribution>] [--binary] <number_of_processes>\n"
+                    "Arrival processes: poisson:<rate>, bursty:<rate>:<multiplier>:<period>, diurnal:<rate>:<amplitude>:<period>\n"
+                    "Distributions: constant:<value>, uniform:<min>:<max>, pareto:<alpha>:<min>[:<cap>],"
+                    " lognormal:<mu>:<sigma>[:<cap>]\n", programName);
+} // End of the print usage function
+
+/**
+ * Generates a mix, written to standard output. For example run commands, please see the README
+ */
+int main(int argc, char *argv[])
+{
+    struct ArrivalProcess arrivals = {0, 0.05, 10.0, 1000.0};
+    struct ValueDistribution distributionB = {1, 1, 10, MAXIMUM_VALUE, 1};
+    struct ValueDistribution distributionC = {2, 1.5, 50, 100000, 1};
+    struct ValueDistribution distributionM = {1, 1, 3, MAXIMUM_VALUE, 0};
+    struct ValueDistribution distributionD = {0, 0, 0, MAXIMUM_VALUE, 0};
+    bool hasDeadlines = false;
+    bool isBinaryFormat = false;
+    uint64_t seed = 0;
+
+    int32_t i = 1;
+    for (; i < argc - 1; ++i)
+    {
+        bool isValid = true;
+        if ((strcmp(argv[i], "--seed") == 0) && (i + 2 < argc))
+            seed = strtoull(argv[++i], NULL, 0);
+        else if ((strcmp(argv[i], "--arrival") == 0) && (i + 2 < argc))
+            isValid = parseArrivalProcess(argv[++i], &arrivals);
+        else if ((strcmp(argv[i], "--B") == 0) && (i + 2 < argc))
+            isValid = parseDistribution(argv[++i], 1, &distributionB);
+        else if ((strcmp(argv[i], "--C") == 0) && (i + 2 < argc))
+            isValid = parseDistribution(argv[++i], 1, &distributionC);
+        else if ((strcmp(argv[i], "--M") == 0) && (i + 2 < argc))
+            isValid = parseDistribution(argv[++i], 0, &distributionM);
+        else if ((strcmp(argv[i], "--D") == 0) && (i + 2 < argc))
+            isValid = hasDeadlines = parseDistribution(argv[++i], 1, &distributionD);
+        else if (strcmp(argv[i], "--binary") == 0)
+            isBinaryFormat = true;
+        else
+            isValid = false;
+
+        // [ERROR CHECKING]: INVALID FLAG
+        if (!isValid)
+        {
+            fprintf(stderr, "Error: invalid argument %s!\n", argv[i]);
+            printUsage(argv[0]);
+            exit(1);
+        }
+    }
+
+    // [ERROR CHECKING]: NO PROCESS COUNT
+    if (i != argc - 1)
+    {
+        printUsage(argv[0]);
+        exit(1);
+    }
+
+    // [ERROR CHECKING]: INVALID PROCESS COUNT
+    uint32_t totalProcesses;
+    if (!parseProcessCount(argv[i], &totalProcesses))
+    {
+        fprintf(stderr, "Error: invalid number of processes %s!\n", argv[i]);
+        printUsage(argv[0]);
+        exit(1);
+    }
+
+    // Every run with the same seed and arguments produces the same mix
+    GENERATOR_STATE = seed;
+    setvbuf(stdout, NULL, _IOFBF, 1 << 20);
+
+    if (isBinaryFormat)
+    {
+        fwrite(VERSIONED_BINARY_WORKLOAD_MAGIC, 1, sizeof(VERSIONED_BINARY_WORKLOAD_MAGIC) - 1, stdout);
+        writeLittleEndian32(stdout, BINARY_WORKLOAD_VERSION);
+        writeLittleEndian32(stdout, totalProcesses);
+    }
+    else
+        printf("%u\n", totalProcesses);
+
+    double currentTime = 0.0;
+    bool isInBurst = false;
+    double stateEndTime = -log(nextUniform()) * arrivals.period;
+    uint32_t processNumber = 0;
+    for (; processNumber < totalProcesses; ++processNumber)
+    {
+        currentTime = nextArrivalTime(&arrivals, currentTime, &isInBurst, &stateEndTime);
+        uint64_t A = (currentTime >= MAXIMUM_VALUE) ? (uint64_t) MAXIMUM_VALUE : (uint64_t) currentTime;
+        uint64_t B = drawValue(&distributionB);
+        uint64_t C = drawValue(&distributionC);
+        uint64_t M = drawValue(&distributionM);
+        // Deadlines are drawn last, so that the rest of the mix is the same with or without them
+        uint64_t D = hasDeadlines ? drawValue(&distributionD) : 0;
+
+        if (isBinaryFormat)
+        {
+            // Every niceness is left at 0
+            writeLittleEndian64(stdout, A);
+            writeLittleEndian64(stdout, B);
+            writeLittleEndian64(stdout, C);
+            writeLittleEndian64(stdout, M);
+            writeLittleEndian64(stdout, D);
+            writeLittleEndian32(stdout, 0);
+        }
+        else if (hasDeadlines)
+            printf("(%" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 ")\n", A, B, C, M, D);
+        else
+            printf("(%" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 ")\n", A, B, C, M);
+    }
+
+    return (fflush(stdout) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+} // End of the main function